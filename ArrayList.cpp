@@ -2,43 +2,163 @@
 #ifndef STRUCTURES_ARRAY_LIST_H
 #define STRUCTURES_ARRAY_LIST_H
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
 
+#include "./BoundsPolicy.cpp"
+#include "./Serialization.cpp"
+#include "./SimdKernels.cpp"
 
 namespace structures {
 
+namespace detail {
+
+// Move 'n' elementos de 'src' para a memória bruta em 'dest', destruindo
+// as origens (as regiões podem se sobrepor)
+template<typename T>
+void relocate(T* dest, T* src, std::size_t n);
+template<typename T>
+void relocate(T* dest, T* src, std::size_t n, std::true_type);
+template<typename T>
+void relocate(T* dest, T* src, std::size_t n, std::false_type);
+
+// Deslocar T não lança: trivialmente copiável ou movimento noexcept
+template<typename T>
+using nothrow_relocatable = std::integral_constant<bool,
+    std::is_trivially_copyable<T>::value ||
+    std::is_nothrow_move_constructible<T>::value>;
+
+// Constrói 'n' elementos em 'dest' a partir de 'src' como
+// std::move_if_noexcept (copia se mover pode lançar); se um lançar, os já
+// construídos são destruídos e as origens continuam intactas
 template<typename T>
+T* construct_if_noexcept(T* dest, T* src, std::size_t n);
+
+}  // namespace detail
+
+// Bounds: verificação de limites (bounds::checked, debug_assert ou
+// unchecked, em BoundsPolicy.cpp)
+template<typename T, typename Bounds = bounds::checked>
 class ArrayList {
  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;  // os elementos são contíguos
+    using const_iterator = const T*;
+
     ArrayList();
-    explicit ArrayList(std::size_t max_size);
+    explicit ArrayList(const std::pmr::polymorphic_allocator<T>& allocator);
+    explicit ArrayList(std::size_t max_size,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    ArrayList(std::size_t max_size, double growth_factor,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
     ~ArrayList();
 
     void clear();
     void push_back(const T& data);
+    void push_back(T&& data);
     void push_front(const T& data);
+    void push_front(T&& data);
     void insert(const T& data, std::size_t index);
+    void insert(T&& data, std::size_t index);
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+    template<typename... Args>
+    T& emplace(std::size_t index, Args&&... args);
     void insert_sorted(const T& data);
     T pop(std::size_t index);
     T pop_back();
     T pop_front();
     void remove(const T& data);
+    template<typename ForwardIt>
+    void insert_range(std::size_t index, ForwardIt first, ForwardIt last);
+    template<typename ForwardIt>
+    void append_range(ForwardIt first, ForwardIt last);
+    void erase_range(std::size_t first, std::size_t last);
+    template<typename Predicate>
+    std::size_t remove_if(Predicate pred);
+    std::size_t remove_all(const T& data);
     bool full() const;
     bool empty() const;
     bool contains(const T& data) const;
     std::size_t find(const T& data) const;
+    std::size_t count(const T& data) const;
+    T min() const;
+    T max() const;
+    T sum() const;
     std::size_t size() const;
     std::size_t max_size() const;
+    std::size_t capacity() const;
+    void reserve(std::size_t new_capacity);
+    void shrink_to_fit();
+    double growth_factor() const;
+    void growth_factor(double factor);
+    std::pmr::memory_resource* resource() const;
     T& at(std::size_t index);
     T& operator[](std::size_t index);
     const T& at(std::size_t index) const;
     const T& operator[](std::size_t index) const;
     // descricao do 'operator []' na FAQ da disciplina
+    T* data();
+    const T* data() const;
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+#if __cplusplus >= 202002L
+    std::span<T> span();
+    std::span<const T> span() const;
+#endif
+    void save(std::ostream& out) const;  // formato em Serialization.cpp
+    void load(std::istream& in);  // substitui o conteúdo da lista
+
+ protected:
+    // usa 'buffer' (de quem herda) enquanto couber em 'buffer_capacity'
+    ArrayList(T* buffer, std::size_t buffer_capacity, double growth_factor,
+              std::pmr::memory_resource* resource);
 
  private:
-    T* contents;
+    T* contents;  // memória bruta: só [0, size_) está construído
     std::size_t size_;
     std::size_t max_size_;
+    double growth_factor_;  // <= 1.0 mantém a capacidade fixa
+    T* inline_{nullptr};  // buffer interno, que não é liberado
+    std::size_t inline_capacity_{0u};
+    std::pmr::memory_resource* resource_;  // origem da memória do vetor
+
+    void expand(std::size_t min_capacity);
+    void reallocate(std::size_t new_capacity);
+    template<typename Fill>
+    void insert_gap(std::size_t index, std::size_t count, Fill fill);
+    void erase_slots(std::size_t first, std::size_t last);
+    template<typename Fill>
+    void rebuild(std::size_t index, std::size_t skip, std::size_t count,
+                 Fill fill);
+    void destroy(std::size_t first, std::size_t last);
+
+    T* allocate(std::size_t n);
+    void deallocate(T* p, std::size_t n);
 
     static const auto DEFAULT_MAX = 10u;
 };
@@ -46,82 +166,154 @@ class ArrayList {
 }  // namespace structures
 
 // Construtor com tamanho padrão
-template<typename T>
-structures::ArrayList<T>::ArrayList() {
+template<typename T, typename Bounds>
+structures::ArrayList<T, Bounds>::ArrayList() {
     size_ = 0;
     max_size_ = DEFAULT_MAX;
-    contents = new T[max_size_];
+    growth_factor_ = 0.0;
+    resource_ = std::pmr::get_default_resource();
+    contents = allocate(max_size_);
+}
+
+// Construtor com tamanho padrão e memória vinda de 'allocator' (um
+// memory_resource* converte para ele). Receber o alocador, e não o
+// ponteiro, mantém ArrayList(0) no construtor com tamanho: 0 também é
+// um ponteiro nulo e as duas sobrecargas ficariam ambíguas.
+template<typename T, typename Bounds>
+structures::ArrayList<T, Bounds>::ArrayList(
+const std::pmr::polymorphic_allocator<T>& allocator) {
+    size_ = 0;
+    max_size_ = DEFAULT_MAX;
+    growth_factor_ = 0.0;
+    resource_ = allocator.resource();
+    contents = allocate(max_size_);
 }
 
 // Construtor com tamanho específico
-template<typename T>
-structures::ArrayList<T>::ArrayList(std::size_t max_size) {
+template<typename T, typename Bounds>
+structures::ArrayList<T, Bounds>::ArrayList(std::size_t max_size,
+std::pmr::memory_resource* resource) {
     size_ = 0;
     max_size_ = max_size;
-    contents = new T[max_size_];
+    growth_factor_ = 0.0;
+    resource_ = resource;
+    contents = allocate(max_size_);
+}
+
+// Construtor com tamanho inicial e fator de crescimento
+template<typename T, typename Bounds>
+structures::ArrayList<T, Bounds>::ArrayList(std::size_t max_size,
+double growth_factor, std::pmr::memory_resource* resource) {
+    size_ = 0;
+    max_size_ = max_size;
+    this->growth_factor(growth_factor);
+    resource_ = resource;
+    contents = allocate(max_size_);
+}
+
+// Construtor que usa um buffer interno até precisar do heap
+template<typename T, typename Bounds>
+structures::ArrayList<T, Bounds>::ArrayList(T* buffer,
+std::size_t buffer_capacity,
+double growth_factor, std::pmr::memory_resource* resource) {
+    size_ = 0;
+    max_size_ = buffer_capacity;
+    this->growth_factor(growth_factor);
+    inline_ = buffer;
+    inline_capacity_ = buffer_capacity;
+    resource_ = resource;
+    contents = buffer;
 }
 
 // Destrutor
-template<typename T>
-structures::ArrayList<T>::~ArrayList() {
-    delete [] contents;
+template<typename T, typename Bounds>
+structures::ArrayList<T, Bounds>::~ArrayList() {
+    clear();
+    if (contents != inline_) {
+        deallocate(contents, max_size_);
+    }
 }
 
 // Limpa a fila
-template<typename T>
-void structures::ArrayList<T>::clear() {
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::clear() {
+    destroy(0, size_);
     size_ = 0;
 }
 
 // Adiciona um elemento no final da lista
-template<typename T>
-void structures::ArrayList<T>::push_back(const T& data) {
-    if (full()) {
-        throw std::out_of_range("lista cheia");
-    }
-    contents[static_cast<int>(size_)] = data;
-    size_++;
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+// Adiciona um elemento no final da lista movendo o dado
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::push_back(T&& data) {
+    emplace_back(std::move(data));
 }
 
 // Adiciona um elemento no início da fila
-template<typename T>
-void structures::ArrayList<T>::push_front(const T& data) {
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::push_front(const T& data) {
+    emplace(0, data);
+}
+
+// Adiciona um elemento no início da fila movendo o dado
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::push_front(T&& data) {
+    emplace(0, std::move(data));
+}
+
+// Adiciona um elemento em uma posição específica
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::insert(const T& data,
+std::size_t index) {
+    emplace(index, data);
+}
+
+// Adiciona um elemento em uma posição específica movendo o dado
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::insert(T&& data, std::size_t index) {
+    emplace(index, std::move(data));
+}
+
+// Constrói um elemento no final da lista
+template<typename T, typename Bounds>
+template<typename... Args>
+T& structures::ArrayList<T, Bounds>::emplace_back(Args&&... args) {
     if (full()) {
-        throw std::out_of_range("lista cheia");
-    }
-    int posicao = static_cast<int>(size_);
-    while (posicao > 0) {
-        contents[posicao] = contents[posicao - 1];
-        posicao--;
+        // os argumentos podem referenciar elementos da própria lista
+        T value(std::forward<Args>(args)...);
+        expand(size_ + 1);
+        new (contents + size_) T(std::move(value));
+    } else {
+        new (contents + size_) T(std::forward<Args>(args)...);
     }
-    contents[0] = data;
     size_++;
+    return contents[size_ - 1];
 }
 
-// Adiciona um elemento em uma posição específica
-template<typename T>
-void structures::ArrayList<T>::insert(const T& data, std::size_t index) {
-    if (index > size_) {
-        throw std::out_of_range("index inválido");
-    }
+// Constrói um elemento em uma posição específica
+template<typename T, typename Bounds>
+template<typename... Args>
+T& structures::ArrayList<T, Bounds>::emplace(std::size_t index,
+Args&&... args) {
+    Bounds::require(index <= size_, "index inválido");
+    T value(std::forward<Args>(args)...);
     if (full()) {
-        throw std::out_of_range("lista cheia");
+        expand(size_ + 1);
     }
-    std::size_t posicao = size_;
-    while (posicao > index) {
-        contents[posicao] = contents[posicao - 1];
-        posicao--;
-    }
-    contents[index] = data;
+    insert_gap(index, 1, [&value](T* slot) {
+        new (slot) T(std::move(value));
+    });
     size_++;
+    return contents[index];
 }
 
 // Insire um elemento em ordem
-template<typename T>
-void structures::ArrayList<T>::insert_sorted(const T& data) {
-    if (full()) {
-        throw std::out_of_range("lista cheia");
-    }
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::insert_sorted(const T& data) {
     std::size_t i = 0;
     while (i < size_ && contents[i] < data) {
         i++;
@@ -130,50 +322,39 @@ void structures::ArrayList<T>::insert_sorted(const T& data) {
 }
 
 // Retira um elemento de um posição específica
-template<typename T>
-T structures::ArrayList<T>::pop(std::size_t index) {
-    if (empty()) {
-        throw std::out_of_range("empty list");
-    }
-    if (index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
-    T value = contents[index];
-    while (index < size_ - 1) {
-        contents[index] = contents[index + 1];
-        index++;
-    }
+template<typename T, typename Bounds>
+T structures::ArrayList<T, Bounds>::pop(std::size_t index) {
+    Bounds::require(!empty(), "empty list");
+    Bounds::require(index < size_, "invalid index");
+    // se mover pode lançar, copia: uma falha ao fechar o buraco não perde
+    // o elemento
+    T value(std::move_if_noexcept(contents[index]));
+    erase_slots(index, index + 1);
     size_--;
     return value;
 }
 
 // Retira um elemento do final da fila
-template<typename T>
-T structures::ArrayList<T>::pop_back() {
-    if (empty()) {
-        throw std::out_of_range("empty list");
-    }
-    T value = contents[size_-1];
+template<typename T, typename Bounds>
+T structures::ArrayList<T, Bounds>::pop_back() {
+    Bounds::require(!empty(), "empty list");
+    T value(std::move(contents[size_ - 1]));
+    contents[size_ - 1].~T();
     size_--;
     return value;
 }
 
 // Retira um elemento do início da fila
-template<typename T>
-T structures::ArrayList<T>::pop_front() {
-    if (empty()) {
-        throw std::out_of_range("empty list");
-    }
-    T value = pop(0);
-    return value;
+template<typename T, typename Bounds>
+T structures::ArrayList<T, Bounds>::pop_front() {
+    Bounds::require(!empty(), "empty list");
+    return pop(0);
 }
 
 // Retira um elemento específico
-template<typename T>
-void structures::ArrayList<T>::remove(const T& data) {
-    if (empty()) {
-        throw std::out_of_range("empty list");
-    }
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::remove(const T& data) {
+    Bounds::require(!empty(), "empty list");
     for (std::size_t i = 0; i < size_; i++) {
         if (data == contents[i]) {
             pop(i);
@@ -182,9 +363,70 @@ void structures::ArrayList<T>::remove(const T& data) {
     }
 }
 
+// Insere os elementos de [first, last) a partir de 'index', deslocando o
+// restante da lista uma única vez (o intervalo não pode ser da própria lista)
+template<typename T, typename Bounds>
+template<typename ForwardIt>
+void structures::ArrayList<T, Bounds>::insert_range(std::size_t index,
+ForwardIt first, ForwardIt last) {
+    Bounds::require(index <= size_, "index inválido");
+    std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+    if (count == 0) {
+        return;
+    }
+    expand(size_ + count);
+    insert_gap(index, count, [first, last](T* slot) {
+        std::uninitialized_copy(first, last, slot);
+    });
+    size_ += count;
+}
+
+// Insere os elementos de [first, last) no final da lista
+template<typename T, typename Bounds>
+template<typename ForwardIt>
+void structures::ArrayList<T, Bounds>::append_range(ForwardIt first,
+ForwardIt last) {
+    insert_range(size_, first, last);
+}
+
+// Retira os elementos das posições [first, last) com um único deslocamento
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::erase_range(std::size_t first,
+std::size_t last) {
+    Bounds::require(first <= last && last <= size_, "invalid index");
+    erase_slots(first, last);
+    size_ -= last - first;
+}
+
+// Retira todos os elementos que satisfazem 'pred' em uma única passada e
+// retorna quantos foram retirados
+template<typename T, typename Bounds>
+template<typename Predicate>
+std::size_t structures::ArrayList<T, Bounds>::remove_if(Predicate pred) {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < size_; i++) {
+        if (!pred(contents[i])) {
+            if (kept != i) {
+                contents[kept] = std::move(contents[i]);
+            }
+            kept++;
+        }
+    }
+    std::size_t removed = size_ - kept;
+    destroy(kept, size_);
+    size_ = kept;
+    return removed;
+}
+
+// Retira todas as ocorrências de um dado e retorna quantas foram retiradas
+template<typename T, typename Bounds>
+std::size_t structures::ArrayList<T, Bounds>::remove_all(const T& data) {
+    return remove_if([&data](const T& value) { return value == data; });
+}
+
 // Testa se a lista está cheia
-template<typename T>
-bool structures::ArrayList<T>::full() const {
+template<typename T, typename Bounds>
+bool structures::ArrayList<T, Bounds>::full() const {
     if (size_ == max_size_) {
         return true;
     }
@@ -192,8 +434,8 @@ bool structures::ArrayList<T>::full() const {
 }
 
 // Testa se a lista está vazia
-template<typename T>
-bool structures::ArrayList<T>::empty() const {
+template<typename T, typename Bounds>
+bool structures::ArrayList<T, Bounds>::empty() const {
     if (size_ == 0) {
         return true;
     }
@@ -201,79 +443,427 @@ bool structures::ArrayList<T>::empty() const {
 }
 
 // Testa se a lista contém um dado específico
-template<typename T>
-bool structures::ArrayList<T>::contains(const T& data) const {
-    if (empty()) {
-        throw std::out_of_range("empty list");
-    }
-    for (std::size_t i = 0; i < size_; i++) {
-        if (data == contents[i]) {
-            return true;
-        }
-    }
-    return false;
+template<typename T, typename Bounds>
+bool structures::ArrayList<T, Bounds>::contains(const T& data) const {
+    Bounds::require(!empty(), "empty list");
+    return kernels::find(contents, size_, data) != size_;
 }
 
 // Procura o index de um dado específico
-template<typename T>
-std::size_t structures::ArrayList<T>::find(const T& data) const {
-    if (empty()) {
-        throw std::out_of_range("empty list");
-    }
-    for (std::size_t i = 0; i < size_; i++) {
-        if (data == contents[i]) {
-            return i;
-        }
-    }
-    return size_;
+template<typename T, typename Bounds>
+std::size_t structures::ArrayList<T, Bounds>::find(const T& data) const {
+    Bounds::require(!empty(), "empty list");
+    return kernels::find(contents, size_, data);
+}
+
+// Conta as ocorrências de um dado específico
+template<typename T, typename Bounds>
+std::size_t structures::ArrayList<T, Bounds>::count(const T& data) const {
+    return kernels::count(contents, size_, data);
+}
+
+// Retorna o menor elemento da lista
+template<typename T, typename Bounds>
+T structures::ArrayList<T, Bounds>::min() const {
+    Bounds::require(!empty(), "empty list");
+    return kernels::min(contents, size_);
+}
+
+// Retorna o maior elemento da lista
+template<typename T, typename Bounds>
+T structures::ArrayList<T, Bounds>::max() const {
+    Bounds::require(!empty(), "empty list");
+    return kernels::max(contents, size_);
+}
+
+// Retorna a soma dos elementos da lista
+template<typename T, typename Bounds>
+T structures::ArrayList<T, Bounds>::sum() const {
+    return kernels::sum(contents, size_);
 }
 
 // Retorna o tamanho da lista
-template<typename T>
-std::size_t structures::ArrayList<T>::size() const {
+template<typename T, typename Bounds>
+std::size_t structures::ArrayList<T, Bounds>::size() const {
     return size_;
 }
 
 // Retorna o tamanho máximo da lista
-template<typename T>
-std::size_t structures::ArrayList<T>::max_size() const {
+template<typename T, typename Bounds>
+std::size_t structures::ArrayList<T, Bounds>::max_size() const {
     return max_size_;
 }
 
-// Retorna o elemento de uma posição em específico
-template<typename T>
-T& structures::ArrayList<T>::at(std::size_t index) {
-    if (empty()) {
-        throw std::out_of_range("empty list");
+// Retorna a capacidade atual da lista
+template<typename T, typename Bounds>
+std::size_t structures::ArrayList<T, Bounds>::capacity() const {
+    return max_size_;
+}
+
+// Garante capacidade para pelo menos 'new_capacity' elementos
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::reserve(std::size_t new_capacity) {
+    if (new_capacity > max_size_) {
+        reallocate(new_capacity);
+    }
+}
+
+// Reduz a capacidade ao número de elementos da lista
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::shrink_to_fit() {
+    if (size_ < max_size_) {
+        reallocate(size_);
+    }
+}
+
+// Retorna o fator de crescimento da lista
+template<typename T, typename Bounds>
+double structures::ArrayList<T, Bounds>::growth_factor() const {
+    return growth_factor_;
+}
+
+// Define o fator de crescimento (0 desativa o crescimento)
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::growth_factor(double factor) {
+    if (factor != 0.0 && !(factor > 1.0)) {
+        throw std::out_of_range("fator de crescimento inválido");
+    }
+    growth_factor_ = factor;
+}
+
+// Retorna a origem da memória da lista
+template<typename T, typename Bounds>
+std::pmr::memory_resource* structures::ArrayList<T, Bounds>::resource() const {
+    return resource_;
+}
+
+// Cresce a lista geometricamente até caber 'min_capacity' elementos, ou
+// falha se a capacidade for fixa
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::expand(std::size_t min_capacity) {
+    if (min_capacity <= max_size_) {
+        return;
+    }
+    if (growth_factor_ <= 1.0) {
+        throw std::out_of_range("lista cheia");
+    }
+    std::size_t new_capacity =
+        static_cast<std::size_t>(static_cast<double>(max_size_) *
+                                 growth_factor_);
+    if (new_capacity < min_capacity) {
+        new_capacity = min_capacity;
     }
-    if (index >= size_) {
-        throw std::out_of_range("invalid index");
+    reallocate(new_capacity);
+}
+
+// Realoca o vetor movendo os elementos para o novo espaço
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::reallocate(std::size_t new_capacity) {
+    T* new_contents;
+    if (inline_ != nullptr && new_capacity <= inline_capacity_) {
+        // volta para o buffer interno em vez de alocar
+        if (contents == inline_) {
+            return;
+        }
+        new_contents = inline_;
+        new_capacity = inline_capacity_;
+    } else {
+        new_contents = allocate(new_capacity);
+    }
+    if constexpr (detail::nothrow_relocatable<T>::value) {
+        detail::relocate(new_contents, contents, size_);
+    } else {
+        // o vetor antigo só é desfeito depois que o novo ficou completo
+        try {
+            detail::construct_if_noexcept(new_contents, contents, size_);
+        } catch (...) {
+            if (new_contents != inline_) {
+                deallocate(new_contents, new_capacity);
+            }
+            throw;
+        }
+        destroy(0, size_);
+    }
+    if (contents != inline_) {
+        deallocate(contents, max_size_);
+    }
+    contents = new_contents;
+    max_size_ = new_capacity;
+}
+
+// Abre 'count' posições em 'index' (a capacidade já basta) e as preenche
+// com fill(primeira posição), que constrói os 'count' elementos ou lança
+// sem deixar nenhum construído. Se deslocar T pode lançar, monta a lista
+// em outro vetor; em qualquer caso uma exceção deixa a lista como estava.
+template<typename T, typename Bounds>
+template<typename Fill>
+void structures::ArrayList<T, Bounds>::insert_gap(std::size_t index,
+std::size_t count, Fill fill) {
+    if constexpr (detail::nothrow_relocatable<T>::value) {
+        detail::relocate(contents + index + count, contents + index,
+                         size_ - index);
+        try {
+            fill(contents + index);
+        } catch (...) {
+            detail::relocate(contents + index, contents + index + count,
+                             size_ - index);
+            throw;
+        }
+    } else {
+        rebuild(index, 0, count, fill);
+    }
+}
+
+// Destrói [first, last) e desloca o restante da lista à esquerda
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::erase_slots(std::size_t first,
+std::size_t last) {
+    if constexpr (detail::nothrow_relocatable<T>::value) {
+        destroy(first, last);
+        detail::relocate(contents + first, contents + last, size_ - last);
+    } else {
+        rebuild(first, last - first, 0, [](T*) {});
     }
+}
+
+// T cujo deslocamento pode lançar: constrói em um vetor novo [0, index),
+// os 'count' elementos de 'fill' e [index + skip, size_), e só então
+// destrói o vetor antigo. Se algo lançar, o vetor novo é descartado.
+template<typename T, typename Bounds>
+template<typename Fill>
+void structures::ArrayList<T, Bounds>::rebuild(std::size_t index,
+std::size_t skip, std::size_t count, Fill fill) {
+    T* fresh = allocate(max_size_);
+    std::size_t built = 0;  // trechos já construídos em 'fresh'
+    try {
+        detail::construct_if_noexcept(fresh, contents, index);
+        built = 1;
+        fill(fresh + index);
+        built = 2;
+        detail::construct_if_noexcept(fresh + index + count,
+                                      contents + index + skip,
+                                      size_ - index - skip);
+    } catch (...) {
+        if (built == 2) {
+            std::destroy(fresh + index, fresh + index + count);
+        }
+        if (built >= 1) {
+            std::destroy(fresh, fresh + index);
+        }
+        deallocate(fresh, max_size_);
+        throw;
+    }
+    destroy(0, size_);
+    if (contents != inline_) {
+        deallocate(contents, max_size_);
+    }
+    contents = fresh;
+}
+
+// Destrói os elementos em [first, last)
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::destroy(std::size_t first,
+std::size_t last) {
+    for (std::size_t i = first; i < last; i++) {
+        contents[i].~T();
+    }
+}
+
+// Aloca memória bruta de 'resource_', sem construir elementos (lança
+// std::bad_array_new_length se n * sizeof(T) não couber em um size_t)
+template<typename T, typename Bounds>
+T* structures::ArrayList<T, Bounds>::allocate(std::size_t n) {
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+        throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+}
+
+// Libera a memória alocada por 'allocate'
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::deallocate(T* p, std::size_t n) {
+    resource_->deallocate(p, n * sizeof(T), alignof(T));
+}
+
+// Retorna o elemento de uma posição em específico
+template<typename T, typename Bounds>
+T& structures::ArrayList<T, Bounds>::at(std::size_t index) {
+    Bounds::require(!empty(), "empty list");
+    Bounds::require(index < size_, "invalid index");
     return contents[index];
 }
 
 // Acesso aos elementos da lista pelo operador []
-template<typename T>
-T& structures::ArrayList<T>::operator[](std::size_t index) {
+template<typename T, typename Bounds>
+T& structures::ArrayList<T, Bounds>::operator[](std::size_t index) {
     return contents[index];
 }
 
 // Retorna como constante o elemento de uma posição em específico
+template<typename T, typename Bounds>
+const T& structures::ArrayList<T, Bounds>::at(std::size_t index) const {
+    Bounds::require(!empty(), "empty list");
+    Bounds::require(index < size_, "invalid index");
+    return contents[index];
+}
+
+// Acesso aos elementos como constante da lista pelo operador []
+template<typename T, typename Bounds>
+const T& structures::ArrayList<T, Bounds>::operator[](std::size_t index) const {
+    return contents[index];
+}
+
+// Ponteiro para o primeiro elemento do vetor contíguo
+template<typename T, typename Bounds>
+T* structures::ArrayList<T, Bounds>::data() {
+    return contents;
+}
+
+// Ponteiro constante para o primeiro elemento do vetor contíguo
+template<typename T, typename Bounds>
+const T* structures::ArrayList<T, Bounds>::data() const {
+    return contents;
+}
+
+// Iterador para o início da lista
+template<typename T, typename Bounds>
+typename structures::ArrayList<T, Bounds>::iterator
+structures::ArrayList<T, Bounds>::begin() {
+    return contents;
+}
+
+// Iterador para depois do último elemento da lista
+template<typename T, typename Bounds>
+typename structures::ArrayList<T, Bounds>::iterator
+structures::ArrayList<T, Bounds>::end() {
+    return contents + size_;
+}
+
+// Iterador constante para o início da lista
+template<typename T, typename Bounds>
+typename structures::ArrayList<T, Bounds>::const_iterator
+structures::ArrayList<T, Bounds>::begin() const {
+    return contents;
+}
+
+// Iterador constante para depois do último elemento da lista
+template<typename T, typename Bounds>
+typename structures::ArrayList<T, Bounds>::const_iterator
+structures::ArrayList<T, Bounds>::end() const {
+    return contents + size_;
+}
+
+// Iterador constante para o início da lista
+template<typename T, typename Bounds>
+typename structures::ArrayList<T, Bounds>::const_iterator
+structures::ArrayList<T, Bounds>::cbegin() const {
+    return contents;
+}
+
+// Iterador constante para depois do último elemento da lista
+template<typename T, typename Bounds>
+typename structures::ArrayList<T, Bounds>::const_iterator
+structures::ArrayList<T, Bounds>::cend() const {
+    return contents + size_;
+}
+
+#if __cplusplus >= 202002L
+// Visão dos elementos da lista sem verificação de limites
+template<typename T, typename Bounds>
+std::span<T> structures::ArrayList<T, Bounds>::span() {
+    return std::span<T>(contents, size_);
+}
+
+// Visão constante dos elementos da lista
+template<typename T, typename Bounds>
+std::span<const T> structures::ArrayList<T, Bounds>::span() const {
+    return std::span<const T>(contents, size_);
+}
+#endif
+
+// Grava a lista em 'out' (um único bloco para tipos trivialmente copiáveis)
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::save(std::ostream& out) const {
+    serialization::write_header<T>(out, size_);
+    serialization::write_elements(out, contents, size_);
+}
+
+// Substitui o conteúdo da lista pela sequência lida de 'in' (a capacidade
+// aumenta se a sequência não couber, mesmo com a capacidade fixa). Se a
+// leitura falhar, a lista fica vazia.
+template<typename T, typename Bounds>
+void structures::ArrayList<T, Bounds>::load(std::istream& in) {
+    std::size_t count = serialization::read_header<T>(in);
+    clear();
+    try {
+        while (size_ < count) {
+            if (full()) {
+                reallocate(serialization::load_capacity(max_size_, count));
+            }
+            std::size_t n = std::min(count, max_size_) - size_;
+            if constexpr (serialization::has_block_codec<T>::value) {
+                serialization::read_elements(in, contents + size_, n);
+                size_ += n;
+            } else {
+                for (std::size_t i = 0; i < n; i++) {
+                    emplace_back(serialization::read_element<T>(in));
+                }
+            }
+        }
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+// Escolhe a realocação conforme o tipo
 template<typename T>
-const T& structures::ArrayList<T>::at(std::size_t index) const {
-    if (empty()) {
-        throw std::out_of_range("empty list");
+void structures::detail::relocate(T* dest, T* src, std::size_t n) {
+    relocate(dest, src, n, std::is_trivially_copyable<T>());
+}
+
+// Tipos trivialmente copiáveis: um único memmove
+template<typename T>
+void structures::detail::relocate(T* dest, T* src, std::size_t n,
+std::true_type) {
+    if (n > 0) {
+        std::memmove(static_cast<void*>(dest), static_cast<const void*>(src),
+                     n * sizeof(T));
     }
-    if (index >= size_) {
-        throw std::out_of_range("invalid index");
+}
+
+// Demais tipos: move elemento a elemento, no sentido que evita sobrescrever
+// origens ainda não movidas
+template<typename T>
+void structures::detail::relocate(T* dest, T* src, std::size_t n,
+std::false_type) {
+    if (dest == src) {
+        return;
+    }
+    if (dest < src) {
+        for (std::size_t i = 0; i < n; i++) {
+            new (dest + i) T(std::move(src[i]));
+            src[i].~T();
+        }
+    } else {
+        for (std::size_t i = n; i > 0; i--) {
+            new (dest + i - 1) T(std::move(src[i - 1]));
+            src[i - 1].~T();
+        }
     }
-    return contents[index];
 }
 
-// Acesso aos elementos como constante da lista pelo operador []
+// Move se não lança, senão copia (um T só movível é movido de qualquer
+// jeito); std::uninitialized_* destrói o que construiu se algo lançar
 template<typename T>
-const T& structures::ArrayList<T>::operator[](std::size_t index) const {
-    return contents[index];
+T* structures::detail::construct_if_noexcept(T* dest, T* src,
+std::size_t n) {
+    if constexpr (std::is_nothrow_move_constructible<T>::value ||
+                  !std::is_copy_constructible<T>::value) {
+        return std::uninitialized_move(src, src + n, dest);
+    } else {
+        return std::uninitialized_copy(src, src + n, dest);
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -2,27 +2,82 @@
 #ifndef STRUCTURES_ARRAY_QUEUE_H
 #define STRUCTURES_ARRAY_QUEUE_H
 
-#include <cstdint>  // std::size_t
+#include <algorithm>  // std::min, std::max, std::move
+#include <cstdint>  // std::size_t, std::uint64_t
+#include <cstring>  // std::memcpy
+#include <istream>  // std::istream
+#include <limits>  // std::numeric_limits
+#include <memory>  // std::uninitialized_copy, std::uninitialized_move
+#include <memory_resource>  // std::pmr::memory_resource
+#include <new>  // std::bad_alloc, std::bad_array_new_length
+#include <ostream>  // std::ostream
 #include <stdexcept>  // C++ Exceptions
+#include <type_traits>  // std::is_trivially_copyable, std::is_nothrow_*
+#include <utility>  // std::move, std::forward
+
+#include "./Serialization.cpp"
 
 namespace structures {
 
+//! Comportamento da fila quando cheia
+enum class QueueMode {
+    fixed,  // enqueue lança "fila cheia" (o padrão)
+    growable,  // dobra a capacidade e volta a encolher quando esvazia
+    overwrite,  // descarta o elemento mais antigo (guarda os últimos N)
+};
+
 template<typename T>
 //! classe ArrayQueue
 class ArrayQueue {
  public:
+    //! trechos contiguos da fila, do inicio ao fim (o segundo e o que deu a
+    //! volta no vetor e pode ser vazio)
+    struct Segments {
+        const T* first;
+        std::size_t first_size;
+        const T* second;
+        std::size_t second_size;
+    };
+
     //! construtor padrao
     ArrayQueue();
+    //! construtor com origem da memoria
+    explicit ArrayQueue(const std::pmr::polymorphic_allocator<T>& allocator);
     //! construtor com parametro
-    explicit ArrayQueue(std::size_t max);
+    explicit ArrayQueue(std::size_t max,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    //! construtor com parametro e modo (growable nunca fica abaixo de max).
+    //! Com overwrite e max 0 nao ha elemento mais antigo para descartar:
+    //! enqueue/emplace lancam "fila cheia" e enqueue_bulk descarta o bloco
+    //! inteiro (contado em overwritten())
+    ArrayQueue(std::size_t max, QueueMode mode,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
     //! destrutor padrao
     ~ArrayQueue();
     //! metodo enfileirar
     void enqueue(const T& data);
-    //! metodo desenfileirar
+    //! metodo enfileira movendo o dado
+    void enqueue(T&& data);
+    //! metodo constroi o elemento no final da fila
+    template<typename... Args>
+    T& emplace(Args&&... args);
+    //! metodo desenfileirar (move o elemento para fora)
     T dequeue();
+    //! metodo desenfileira movendo o inicio para 'data'
+    void dequeue_into(T& data);
     //! metodo retorna o ultimo
     T& back();
+    //! metodo enfileira 'count' elementos contiguos; retorna quantos couberam
+    std::size_t enqueue_bulk(const T* first, std::size_t count);
+    //! metodo desenfileira ate 'max' elementos em 'out'; retorna quantos
+    std::size_t dequeue_bulk(T* out, std::size_t max);
+    //! metodo expoe os elementos sem copiar (valido ate a proxima mudanca)
+    Segments peek() const;
+    //! metodo descarta os 'count' primeiros (depois de um peek)
+    void discard(std::size_t count);
+    //! metodo copia a fila, do inicio ao fim, para 'out'
+    template<typename OutputIt>
+    OutputIt snapshot(OutputIt out) const;
     //! metodo limpa a fila
     void clear();
     //! metodo retorna tamanho atual
@@ -33,55 +88,136 @@ class ArrayQueue {
     bool empty();
     //! metodo verifica se esta cheio
     bool full();
+    //! metodo retorna a origem da memoria
+    std::pmr::memory_resource* resource() const;
+    //! metodo retorna o modo da fila
+    QueueMode mode() const;
+    //! metodo retorna quantos elementos o modo overwrite ja descartou
+    std::uint64_t overwritten() const;
+    //! metodo grava a fila, do inicio ao fim (formato em Serialization.cpp)
+    void save(std::ostream& out) const;
+    //! metodo substitui a fila pelo conteudo lido
+    void load(std::istream& in);
 
  private:
+    // Os cursores só crescem; a posição no vetor é 'cursor & mask_' e o
+    // tamanho é tail_ - head_, sem divisão nem sentinela. Só as posições
+    // entre head_ e tail_ têm elementos construídos.
     T* contents;
-    std::size_t size_;
+    std::uint64_t head_;  // total de elementos ja retirados
+    std::uint64_t tail_;  // total de elementos ja inseridos
     std::size_t max_size_;
-    int begin_;  // indice do inicio (para fila circular)
-    int end_;  // indice do fim (para fila circular)
+    std::size_t mask_;  // posicoes - 1 (potencia de dois >= max_size_)
+    std::size_t min_size_;  // modo growable: nao encolhe abaixo disto
+    std::uint64_t overwritten_{0u};  // modo overwrite: descartados
+    QueueMode mode_;
+    std::pmr::memory_resource* resource_;
+
+    void resize(std::size_t new_max_size);
+    void shrink_if_sparse();
+    static T* relocate(T* first, T* last, T* out);
+    void destroy_range(std::uint64_t first, std::uint64_t last);
+    void allocate();
+    void deallocate();
+
     static const auto DEFAULT_SIZE = 10u;
 };
 
 }  // namespace structures
 
-#endif
-
 // Construtor com tamanho padrão
 template<typename T>
 structures::ArrayQueue<T>::ArrayQueue() {
     max_size_ = DEFAULT_SIZE;
-    size_ = 0;
-    contents = new T[max_size_];
-    begin_ = 0;
-    end_ = -1;
+    min_size_ = DEFAULT_SIZE;
+    mode_ = QueueMode::fixed;
+    resource_ = std::pmr::get_default_resource();
+    allocate();
+    head_ = 0;
+    tail_ = 0;
+}
+
+// Construtor com tamanho padrão e memória vinda de 'allocator'
+template<typename T>
+structures::ArrayQueue<T>::ArrayQueue(
+const std::pmr::polymorphic_allocator<T>& allocator) {
+    max_size_ = DEFAULT_SIZE;
+    min_size_ = DEFAULT_SIZE;
+    mode_ = QueueMode::fixed;
+    resource_ = allocator.resource();
+    allocate();
+    head_ = 0;
+    tail_ = 0;
 }
 
 // Construtor com tamanho específico
 template<typename T>
-structures::ArrayQueue<T>::ArrayQueue(std::size_t max) {
+structures::ArrayQueue<T>::ArrayQueue(std::size_t max,
+std::pmr::memory_resource* resource) {
     max_size_ = max;
-    size_ = 0;
-    contents = new T[max_size_];
-    begin_ = 0;
-    end_ = -1;
+    min_size_ = max;
+    mode_ = QueueMode::fixed;
+    resource_ = resource;
+    allocate();
+    head_ = 0;
+    tail_ = 0;
+}
+
+// Construtor com tamanho inicial e modo específicos
+template<typename T>
+structures::ArrayQueue<T>::ArrayQueue(std::size_t max, QueueMode mode,
+std::pmr::memory_resource* resource) {
+    max_size_ = max;
+    min_size_ = max;
+    mode_ = mode;
+    resource_ = resource;
+    allocate();
+    head_ = 0;
+    tail_ = 0;
 }
 
 // Destrutor
 template<typename T>
 structures::ArrayQueue<T>::~ArrayQueue() {
-    delete [] contents;
+    deallocate();
 }
 
-// Adiciona um elemento no final da fila
+// Adiciona uma cópia do dado no final da fila
 template<typename T>
 void structures::ArrayQueue<T>::enqueue(const T& data) {
-    if (full()) {
+    emplace(data);
+}
+
+// Adiciona o dado no final da fila, movendo-o
+template<typename T>
+void structures::ArrayQueue<T>::enqueue(T&& data) {
+    emplace(std::move(data));
+}
+
+// Constrói um elemento no final da fila a partir de 'args'
+template<typename T>
+template<typename... Args>
+T& structures::ArrayQueue<T>::emplace(Args&&... args) {
+    if (!full()) {
+        new (contents + (tail_ & mask_)) T(std::forward<Args>(args)...);
+    } else if (mode_ == QueueMode::growable) {
+        // constrói antes de crescer: 'args' pode ser um elemento da fila
+        T value(std::forward<Args>(args)...);
+        resize(max_size_ == 0 ? 1 : max_size_ * 2);
+        new (contents + (tail_ & mask_)) T(std::move(value));
+    } else if (mode_ == QueueMode::overwrite && max_size_ > 0) {
+        // o mais antigo sai; com o vetor exatamente cheio, a posição
+        // escrita é a dele
+        T value(std::forward<Args>(args)...);
+        destroy_range(head_, head_ + 1);
+        head_++;
+        overwritten_++;
+        new (contents + (tail_ & mask_)) T(std::move(value));
+    } else {
         throw std::out_of_range("fila cheia");
     }
-    end_ = (end_ + 1) % max_size_;
-    contents[end_] = data;
-    size_++;
+    tail_++;
+    return contents[(tail_ - 1) & mask_];
 }
 
 // Remove um elemento do início da fila e o retorna
@@ -90,33 +226,153 @@ T structures::ArrayQueue<T>::dequeue() {
     if (empty()) {
         throw std::out_of_range("fila vazia");
     }
-    T data = contents[begin_];
-    begin_ = (begin_ + 1) % max_size_;
-    size_--;
+    T data(std::move(contents[head_ & mask_]));
+    destroy_range(head_, head_ + 1);
+    head_++;
+    shrink_if_sparse();
     return data;
 }
 
+// Remove um elemento do início da fila, movendo-o para 'data'
+template<typename T>
+void structures::ArrayQueue<T>::dequeue_into(T& data) {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    }
+    data = std::move(contents[head_ & mask_]);
+    destroy_range(head_, head_ + 1);
+    head_++;
+    shrink_if_sparse();
+}
+
 // Consulta o elemento no final da fila
 template<typename T>
 T& structures::ArrayQueue<T>::back() {
     if (empty()) {
         throw std::out_of_range("fila vazia");
     }
-    return contents[end_];
+    return contents[(tail_ - 1) & mask_];
+}
+
+// Enfileira 'count' elementos a partir de 'first' com no máximo duas cópias
+// em bloco (memcpy para tipos trivialmente copiáveis). No modo fixed só
+// enfileira o que couber; no growable cresce uma vez para caber tudo; no
+// overwrite descarta os mais antigos (da fila e, se preciso, do bloco).
+// 'first' não pode apontar para a própria fila.
+template<typename T>
+std::size_t structures::ArrayQueue<T>::enqueue_bulk(const T* first,
+std::size_t count) {
+    std::size_t accepted = count;
+    std::size_t size = static_cast<std::size_t>(tail_ - head_);
+    if (count > max_size_ - size) {
+        if (mode_ == QueueMode::growable) {
+            resize(std::max(size + count, max_size_ * 2));
+        } else if (mode_ == QueueMode::overwrite) {
+            if (count > max_size_) {
+                overwritten_ += count - max_size_;
+                first += count - max_size_;
+                count = max_size_;
+            }
+            std::size_t dropped = size + count - max_size_;
+            destroy_range(head_, head_ + dropped);
+            head_ += dropped;
+            overwritten_ += dropped;
+        } else {
+            count = max_size_ - size;
+            accepted = count;
+        }
+    }
+    std::size_t end = static_cast<std::size_t>(tail_ & mask_);
+    std::size_t part = std::min(count, mask_ + 1 - end);
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (count > 0) {
+            std::memcpy(contents + end, first, part * sizeof(T));
+            std::memcpy(contents, first + part, (count - part) * sizeof(T));
+        }
+        tail_ += count;
+    } else {
+        // a cauda avança a cada trecho: se a segunda cópia lançar, o
+        // primeiro já faz parte da fila
+        std::uninitialized_copy(first, first + part, contents + end);
+        tail_ += part;
+        std::uninitialized_copy(first + part, first + count, contents);
+        tail_ += count - part;
+    }
+    return accepted;
+}
+
+// Desenfileira até 'max' elementos para 'out' com no máximo duas cópias em
+// bloco; retorna quantos foram retirados (0 se a fila estiver vazia)
+template<typename T>
+std::size_t structures::ArrayQueue<T>::dequeue_bulk(T* out,
+std::size_t max) {
+    std::size_t count = std::min(max,
+                                 static_cast<std::size_t>(tail_ - head_));
+    std::size_t begin = static_cast<std::size_t>(head_ & mask_);
+    std::size_t part = std::min(count, mask_ + 1 - begin);
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (count > 0) {
+            std::memcpy(out, contents + begin, part * sizeof(T));
+            std::memcpy(out + part, contents, (count - part) * sizeof(T));
+        }
+    } else {
+        std::move(contents + begin, contents + begin + part, out);
+        std::move(contents, contents + (count - part), out + part);
+        destroy_range(head_, head_ + count);
+    }
+    head_ += count;
+    shrink_if_sparse();
+    return count;
+}
+
+// Expõe os elementos da fila em até dois trechos contíguos, sem copiar
+template<typename T>
+typename structures::ArrayQueue<T>::Segments
+structures::ArrayQueue<T>::peek() const {
+    std::size_t size = static_cast<std::size_t>(tail_ - head_);
+    std::size_t begin = static_cast<std::size_t>(head_ & mask_);
+    std::size_t part = std::min(size, mask_ + 1 - begin);
+    return Segments{contents + begin, part, contents, size - part};
+}
+
+// Copia os elementos da fila, em ordem, para 'out' (a janela atual do
+// modo overwrite); retorna o iterador depois do último copiado
+template<typename T>
+template<typename OutputIt>
+OutputIt structures::ArrayQueue<T>::snapshot(OutputIt out) const {
+    Segments segments = peek();
+    out = std::copy(segments.first, segments.first + segments.first_size,
+                    out);
+    return std::copy(segments.second,
+                     segments.second + segments.second_size, out);
+}
+
+// Descarta os 'count' primeiros elementos da fila
+template<typename T>
+void structures::ArrayQueue<T>::discard(std::size_t count) {
+    if (count > tail_ - head_) {
+        throw std::out_of_range("fila vazia");
+    }
+    destroy_range(head_, head_ + count);
+    head_ += count;
+    shrink_if_sparse();
 }
 
 // Limpa a fila
 template<typename T>
 void structures::ArrayQueue<T>::clear() {
-    size_ = 0;
-    begin_ = 0;
-    end_ = -1;
+    destroy_range(head_, tail_);
+    head_ = 0;
+    tail_ = 0;
+    if (mode_ == QueueMode::growable && max_size_ > min_size_) {
+        resize(min_size_);
+    }
 }
 
 // Consulta o tamanho da fila
 template<typename T>
 std::size_t structures::ArrayQueue<T>::size() {
-    return size_;
+    return static_cast<std::size_t>(tail_ - head_);
 }
 
 // Consulta o tamanho máximo da fila
@@ -128,11 +384,181 @@ std::size_t structures::ArrayQueue<T>::max_size() {
 // Verifica se a fila está vazia e retorna um bool
 template<typename T>
 bool structures::ArrayQueue<T>::empty() {
-    return (size_ == 0);
+    return (tail_ == head_);
 }
 
 // Verifica se a fila está cheia e retorna um bool
 template<typename T>
 bool structures::ArrayQueue<T>::full() {
-    return (size_ == max_size_);
-}
\ No newline at end of file
+    return (tail_ - head_ == max_size_);
+}
+
+// Consulta a origem da memória da fila
+template<typename T>
+std::pmr::memory_resource* structures::ArrayQueue<T>::resource() const {
+    return resource_;
+}
+
+// Consulta o modo da fila
+template<typename T>
+structures::QueueMode structures::ArrayQueue<T>::mode() const {
+    return mode_;
+}
+
+// Consulta quantos elementos o modo overwrite já descartou (o contador
+// não volta a zero com clear)
+template<typename T>
+std::uint64_t structures::ArrayQueue<T>::overwritten() const {
+    return overwritten_;
+}
+
+// Grava a fila em 'out': no máximo dois blocos, antes e depois da volta
+template<typename T>
+void structures::ArrayQueue<T>::save(std::ostream& out) const {
+    std::size_t size = static_cast<std::size_t>(tail_ - head_);
+    std::size_t begin = static_cast<std::size_t>(head_ & mask_);
+    serialization::write_header<T>(out, size);
+    std::size_t first = std::min(size, mask_ + 1 - begin);
+    serialization::write_elements(out, contents + begin, first);
+    serialization::write_elements(out, contents, size - first);
+}
+
+// Substitui a fila pela sequência lida de 'in' (cresce se não couber).
+// Se a leitura falhar, a fila fica vazia.
+template<typename T>
+void structures::ArrayQueue<T>::load(std::istream& in) {
+    std::size_t count = serialization::read_header<T>(in);
+    clear();
+    try {
+        // depois de clear e de resize, head_ é 0: os elementos ficam
+        // contíguos a partir de contents
+        while (tail_ < count) {
+            if (tail_ == max_size_) {
+                resize(serialization::load_capacity(max_size_, count));
+            }
+            std::size_t loaded = static_cast<std::size_t>(tail_);
+            std::size_t n = std::min(count, max_size_) - loaded;
+            if constexpr (serialization::has_block_codec<T>::value) {
+                serialization::read_elements(in, contents + loaded, n);
+                tail_ += n;
+            } else {
+                for (std::size_t i = 0; i < n; i++) {
+                    new (contents + loaded + i) T(
+                        serialization::read_element<T>(in));
+                    tail_++;
+                }
+            }
+        }
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+// Troca o vetor por um de capacidade 'new_max_size' (que comporta a fila),
+// desfazendo a volta com no máximo dois blocos de movimentação. Se mover
+// lançar, a fila continua no vetor antigo.
+template<typename T>
+void structures::ArrayQueue<T>::resize(std::size_t new_max_size) {
+    std::size_t size = static_cast<std::size_t>(tail_ - head_);
+    std::size_t begin = static_cast<std::size_t>(head_ & mask_);
+    std::size_t first = std::min(size, mask_ + 1 - begin);
+    T* old_contents = contents;
+    std::size_t old_max_size = max_size_;
+    std::size_t old_mask = mask_;
+    max_size_ = new_max_size;
+    T* moved = nullptr;
+    try {
+        allocate();
+        moved = contents;
+        moved = relocate(old_contents + begin, old_contents + begin + first,
+                         contents);
+        relocate(old_contents, old_contents + (size - first), moved);
+    } catch (...) {
+        if (moved != nullptr) {
+            std::destroy(contents, moved);
+            resource_->deallocate(contents, (mask_ + 1) * sizeof(T),
+                                  alignof(T));
+        }
+        contents = old_contents;
+        max_size_ = old_max_size;
+        mask_ = old_mask;
+        throw;
+    }
+    std::destroy(old_contents + begin, old_contents + begin + first);
+    std::destroy(old_contents, old_contents + (size - first));
+    resource_->deallocate(old_contents, (old_mask + 1) * sizeof(T),
+                          alignof(T));
+    head_ = 0;
+    tail_ = size;
+}
+
+// Modo growable: encolhe só com um quarto ocupado, para não realocar de
+// novo logo no próximo enqueue. Encolher é opcional: se resize falhar (sem
+// memória, cópia que lança), continua com o vetor atual. Um T só movível
+// cujo movimento pode lançar perderia elementos no meio do caminho, então
+// nesse caso a fila não encolhe.
+template<typename T>
+void structures::ArrayQueue<T>::shrink_if_sparse() {
+    if constexpr (!std::is_nothrow_move_constructible<T>::value &&
+                  !std::is_copy_constructible<T>::value) {
+        return;
+    } else if (mode_ == QueueMode::growable && max_size_ > min_size_ &&
+               tail_ - head_ <= max_size_ / 4) {
+        try {
+            resize(std::max(max_size_ / 2, min_size_));
+        } catch (...) {
+        }
+    }
+}
+
+// Constrói [first, last) em 'out' como std::move_if_noexcept: move se não
+// lança, senão copia, para que uma falha deixe o vetor antigo intacto
+template<typename T>
+T* structures::ArrayQueue<T>::relocate(T* first, T* last, T* out) {
+    if constexpr (std::is_nothrow_move_constructible<T>::value ||
+                  !std::is_copy_constructible<T>::value) {
+        return std::uninitialized_move(first, last, out);
+    } else {
+        return std::uninitialized_copy(first, last, out);
+    }
+}
+
+// Destrói os elementos entre os cursores 'first' e 'last' (no máximo dois
+// trechos do vetor)
+template<typename T>
+void structures::ArrayQueue<T>::destroy_range(std::uint64_t first,
+std::uint64_t last) {
+    std::size_t count = static_cast<std::size_t>(last - first);
+    std::size_t begin = static_cast<std::size_t>(first & mask_);
+    std::size_t part = std::min(count, mask_ + 1 - begin);
+    std::destroy(contents + begin, contents + begin + part);
+    std::destroy(contents, contents + (count - part));
+}
+
+// Aloca o vetor em 'resource_' com a menor potência de dois que comporte
+// 'max_size_', sem construir as posições (lança std::bad_array_new_length
+// se o tamanho em bytes não couber em um size_t)
+template<typename T>
+void structures::ArrayQueue<T>::allocate() {
+    std::size_t capacity = 1;
+    while (capacity < max_size_) {
+        if (capacity > std::numeric_limits<std::size_t>::max() / 2 /
+                       sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        capacity *= 2;
+    }
+    contents = static_cast<T*>(
+        resource_->allocate(capacity * sizeof(T), alignof(T)));
+    mask_ = capacity - 1;
+}
+
+// Destrói os elementos da fila e devolve o vetor para 'resource_'
+template<typename T>
+void structures::ArrayQueue<T>::deallocate() {
+    destroy_range(head_, tail_);
+    resource_->deallocate(contents, (mask_ + 1) * sizeof(T), alignof(T));
+}
+
+#endif
@@ -2,8 +2,19 @@
 #ifndef STRUCTURES_ARRAY_STACK_H
 #define STRUCTURES_ARRAY_STACK_H
 
+#include <algorithm>  // std::min
 #include <cstdint>  // std::size_t
+#include <istream>  // std::istream
+#include <limits>  // std::numeric_limits
+#include <memory>  // std::destroy_n, std::uninitialized_move
+#include <memory_resource>  // std::pmr::memory_resource
+#include <new>  // placement new, std::bad_array_new_length
+#include <ostream>  // std::ostream
 #include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_nothrow_move_constructible
+#include <utility>  // std::move, std::forward
+
+#include "./Serialization.cpp"
 
 namespace structures {
 
@@ -13,14 +24,24 @@ class ArrayStack {
  public:
     //! construtor simples
     ArrayStack();
+    //! construtor com origem da memoria
+    explicit ArrayStack(const std::pmr::polymorphic_allocator<T>& allocator);
     //! construtor com parametro tamanho
-    explicit ArrayStack(std::size_t max);
+    explicit ArrayStack(std::size_t max,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
     //! destrutor
     ~ArrayStack();
     //! metodo empilha
     void push(const T& data);
-    //! metodo desempilha
+    //! metodo empilha movendo o dado
+    void push(T&& data);
+    //! metodo constroi o elemento no topo
+    template<typename... Args>
+    T& emplace(Args&&... args);
+    //! metodo desempilha (move o topo para fora)
     T pop();
+    //! metodo desempilha movendo o topo para 'data'
+    void pop_into(T& data);
     //! metodo retorna o topo
     T& top();
     //! metodo limpa pilha
@@ -33,52 +54,86 @@ class ArrayStack {
     bool empty();
     //! verifica se esta cheia
     bool full();
+    //! retorna a origem da memoria
+    std::pmr::memory_resource* resource() const;
+    //! grava a pilha, da base ao topo (formato em Serialization.cpp)
+    void save(std::ostream& out) const;
+    //! substitui a pilha pelo conteudo lido
+    void load(std::istream& in);
 
  private:
-    T* contents;
-    int top_;
+    T* contents;  // so as posicoes abaixo de size_ estao construidas
+    std::size_t size_;  // o topo e contents[size_ - 1]
     std::size_t max_size_;
+    std::pmr::memory_resource* resource_;
+
+    void allocate();
+    void deallocate();
+    void resize(std::size_t new_max_size);
 
     static const auto DEFAULT_SIZE = 10u;
 };
 
 }  // namespace structures
 
-#endif
-
 // Construtor com tamanho padrão
 template<typename T>
 structures::ArrayStack<T>::ArrayStack() {
     max_size_ = DEFAULT_SIZE;
-    contents = new T[max_size_];
-    top_ = -1;
+    resource_ = std::pmr::get_default_resource();
+    allocate();
+    size_ = 0;
+}
+
+// Construtor com tamanho padrão e memória vinda de 'allocator'
+template<typename T>
+structures::ArrayStack<T>::ArrayStack(
+const std::pmr::polymorphic_allocator<T>& allocator) {
+    max_size_ = DEFAULT_SIZE;
+    resource_ = allocator.resource();
+    allocate();
+    size_ = 0;
 }
 
 // Construtor com tamanho específico
 template<typename T>
-structures::ArrayStack<T>::ArrayStack(std::size_t max) {
+structures::ArrayStack<T>::ArrayStack(std::size_t max,
+std::pmr::memory_resource* resource) {
     // COLOQUE SEU CODIGO AQUI...
     max_size_ = max;
-    contents = new T[max_size_];
-    top_ = -1;
+    resource_ = resource;
+    allocate();
+    size_ = 0;
 }
 
 // Destrutor
 template<typename T>
 structures::ArrayStack<T>::~ArrayStack() {
-    delete [] contents;
+    deallocate();
 }
 
-// Adiciona um elemento no topo da pilha
+// Adiciona uma cópia do dado no topo da pilha
 template<typename T>
 void structures::ArrayStack<T>::push(const T& data) {
+    emplace(data);
+}
+
+// Adiciona o dado no topo da pilha, movendo-o
+template<typename T>
+void structures::ArrayStack<T>::push(T&& data) {
+    emplace(std::move(data));
+}
+
+// Constrói um elemento no topo da pilha a partir de 'args'
+template<typename T>
+template<typename... Args>
+T& structures::ArrayStack<T>::emplace(Args&&... args) {
     if (full()) {
         throw std::out_of_range("pilha cheia");
-    } else {
-        // COLOQUE SEU CODIGO AQUI...
-        top_++;
-        contents[top_] = data;
     }
+    T* slot = new (contents + size_) T(std::forward<Args>(args)...);
+    size_++;
+    return *slot;
 }
 
 // Remove o elelemento do topo da pilha e o retorna
@@ -88,11 +143,23 @@ T structures::ArrayStack<T>::pop() {
     if (empty()) {
         throw std::out_of_range("pilha vazia");
     }
-    T temp = contents[top_];
-    top_--;
+    T temp(std::move(contents[size_ - 1]));
+    contents[size_ - 1].~T();
+    size_--;
     return temp;
 }
 
+// Remove o elemento do topo da pilha, movendo-o para 'data'
+template<typename T>
+void structures::ArrayStack<T>::pop_into(T& data) {
+    if (empty()) {
+        throw std::out_of_range("pilha vazia");
+    }
+    data = std::move(contents[size_ - 1]);
+    contents[size_ - 1].~T();
+    size_--;
+}
+
 // Consulta o elemento no topo da pilha
 template<typename T>
 T& structures::ArrayStack<T>::top() {
@@ -100,21 +167,22 @@ T& structures::ArrayStack<T>::top() {
     if (empty()) {
         throw std::out_of_range("pilha vazia");
     }
-    return contents[top_];
+    return contents[size_ - 1];
 }
 
 // Esvazia a pilha
 template<typename T>
 void structures::ArrayStack<T>::clear() {
     // COLOQUE SEU CODIGO AQUI...
-    top_ = -1;
+    std::destroy_n(contents, size_);
+    size_ = 0;
 }
 
 // Consulta o tamanho da pilha
 template<typename T>
 std::size_t structures::ArrayStack<T>::size() {
     // COLOQUE SEU CODIGO AQUI...
-    return top_ + 1;
+    return size_;
 }
 
 // Consulta o tamanho máximon da pilha
@@ -128,12 +196,108 @@ std::size_t structures::ArrayStack<T>::max_size() {
 template<typename T>
 bool structures::ArrayStack<T>::empty() {
     // COLOQUE SEU CODIGO AQUI...
-    return (top_ == -1);
+    return (size_ == 0);
 }
 
 // Verifica se a pilha está cheia e retorna um bool
 template<typename T>
 bool structures::ArrayStack<T>::full() {
     // COLOQUE SEU CODIGO AQUI...
-    return (top_ == static_cast<int>(max_size_) -1);
-}
\ No newline at end of file
+    return (size_ == max_size_);
+}
+
+// Consulta a origem da memória da pilha
+template<typename T>
+std::pmr::memory_resource* structures::ArrayStack<T>::resource() const {
+    return resource_;
+}
+
+// Grava a pilha em 'out' em um único bloco, da base ao topo
+template<typename T>
+void structures::ArrayStack<T>::save(std::ostream& out) const {
+    serialization::write_header<T>(out, size_);
+    serialization::write_elements(out, contents, size_);
+}
+
+// Substitui a pilha pela sequência lida de 'in' (cresce se não couber).
+// Se a leitura falhar, a pilha fica vazia.
+template<typename T>
+void structures::ArrayStack<T>::load(std::istream& in) {
+    std::size_t count = serialization::read_header<T>(in);
+    clear();
+    try {
+        while (size_ < count) {
+            if (full()) {
+                resize(serialization::load_capacity(max_size_, count));
+            }
+            std::size_t n = std::min(count, max_size_) - size_;
+            if constexpr (serialization::has_block_codec<T>::value) {
+                serialization::read_elements(in, contents + size_, n);
+                size_ += n;
+            } else {
+                for (std::size_t i = 0; i < n; i++) {
+                    new (contents + size_) T(
+                        serialization::read_element<T>(in));
+                    size_++;
+                }
+            }
+        }
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+// Troca o vetor por um de capacidade 'new_max_size' (>= size_); se mover
+// lançar, a pilha continua no vetor antigo
+template<typename T>
+void structures::ArrayStack<T>::resize(std::size_t new_max_size) {
+    T* old_contents = contents;
+    std::size_t old_max_size = max_size_;
+    max_size_ = new_max_size;
+    try {
+        allocate();
+    } catch (...) {
+        contents = old_contents;
+        max_size_ = old_max_size;
+        throw;
+    }
+    try {
+        if constexpr (std::is_nothrow_move_constructible<T>::value ||
+                      !std::is_copy_constructible<T>::value) {
+            std::uninitialized_move(old_contents, old_contents + size_,
+                                    contents);
+        } else {
+            std::uninitialized_copy(old_contents, old_contents + size_,
+                                    contents);
+        }
+    } catch (...) {
+        resource_->deallocate(contents, max_size_ * sizeof(T), alignof(T));
+        contents = old_contents;
+        max_size_ = old_max_size;
+        throw;
+    }
+    std::destroy_n(old_contents, size_);
+    resource_->deallocate(old_contents, old_max_size * sizeof(T),
+                          alignof(T));
+}
+
+// Aloca o vetor em 'resource_', sem construir as posições (lança
+// std::bad_array_new_length se o tamanho em bytes não couber em um size_t)
+template<typename T>
+void structures::ArrayStack<T>::allocate() {
+    if (max_size_ > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+        throw std::bad_array_new_length();
+    }
+    contents = static_cast<T*>(
+        resource_->allocate(max_size_ * sizeof(T), alignof(T)));
+}
+
+// Destrói os elementos da pilha e devolve o vetor para 'resource_'
+template<typename T>
+void structures::ArrayStack<T>::deallocate() {
+    std::destroy_n(contents, size_);
+    resource_->deallocate(contents, max_size_ * sizeof(T), alignof(T));
+}
+
+#endif
@@ -0,0 +1,324 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_BLOCKING_QUEUE_H
+#define STRUCTURES_BLOCKING_QUEUE_H
+
+#include <chrono>  // std::chrono::duration
+#include <condition_variable>  // std::condition_variable
+#include <cstdint>  // std::size_t
+#include <memory_resource>  // std::pmr::memory_resource
+#include <mutex>  // std::mutex, std::unique_lock
+#include <utility>  // std::move, std::forward
+
+#include "./ArrayQueue.cpp"
+
+namespace structures {
+
+template<typename T>
+//! Fila limitada para produtores e consumidores em threads diferentes,
+//! guardada em uma ArrayQueue. push espera enquanto a fila está cheia e pop
+//! enquanto está vazia, dormindo numa variável de condição em vez de ficar
+//! testando empty(). Depois de close() os pushes falham e os pops esvaziam
+//! o que sobrou e então retornam false.
+class BlockingQueue {
+ public:
+    //! construtor padrao
+    BlockingQueue();
+    //! construtor com origem da memoria
+    explicit BlockingQueue(const std::pmr::polymorphic_allocator<T>& allocator);
+    //! construtor com parametro
+    explicit BlockingQueue(std::size_t max,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+    //! enfileira esperando espaco; false se a fila foi fechada
+    bool push(const T& data);
+    //! enfileira movendo o dado
+    bool push(T&& data);
+    //! constroi o elemento no fim, esperando espaco; false se fechada
+    template<typename... Args>
+    bool emplace(Args&&... args);
+    //! enfileira se houver espaco, sem esperar
+    bool try_push(const T& data);
+    //! idem, movendo o dado
+    bool try_push(T&& data);
+    //! constroi o elemento no fim se houver espaco, sem esperar
+    template<typename... Args>
+    bool try_emplace(Args&&... args);
+    //! enfileira 'count' elementos, esperando espaco quantas vezes for
+    //! preciso; retorna quantos entraram (menos que 'count' se fechada)
+    std::size_t push_bulk(const T* first, std::size_t count);
+    //! desenfileira esperando um elemento; false se fechada e vazia
+    bool pop(T& data);
+    //! desenfileira se houver elemento, sem esperar
+    bool try_pop(T& data);
+    //! desenfileira esperando no maximo 'timeout'
+    template<typename Rep, typename Period>
+    bool try_pop_for(T& data,
+                     const std::chrono::duration<Rep, Period>& timeout);
+    //! espera um elemento e retira ate 'max' de uma vez; 0 se fechada e vazia
+    std::size_t pop_bulk(T* out, std::size_t max);
+    //! fecha a fila e acorda todas as threads esperando
+    void close();
+    //! fila fechada
+    bool closed();
+    //! tamanho atual
+    std::size_t size();
+    //! tamanho maximo
+    std::size_t max_size();
+    //! origem da memoria
+    std::pmr::memory_resource* resource() const;
+
+ private:
+    // Só notifica quando alguém está esperando, e as operações em bloco
+    // notificam uma vez por bloco em vez de uma vez por elemento
+    void wake_consumers(std::unique_lock<std::mutex>& lock,
+                        std::size_t count);
+    void wake_producers(std::unique_lock<std::mutex>& lock,
+                        std::size_t count);
+
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::size_t waiting_consumers_{0u};
+    std::size_t waiting_producers_{0u};
+    bool closed_{false};
+    ArrayQueue<T> queue_;
+};
+
+}  // namespace structures
+
+// Construtor com tamanho padrão
+template<typename T>
+structures::BlockingQueue<T>::BlockingQueue() {
+}
+
+// Construtor com tamanho padrão e memória vinda de 'allocator'
+template<typename T>
+structures::BlockingQueue<T>::BlockingQueue(
+const std::pmr::polymorphic_allocator<T>& allocator):
+    queue_(allocator.resource())
+{}
+
+// Construtor com tamanho específico
+template<typename T>
+structures::BlockingQueue<T>::BlockingQueue(std::size_t max,
+std::pmr::memory_resource* resource):
+    queue_(max, resource)
+{}
+
+// Enfileira uma cópia do elemento, esperando enquanto a fila estiver cheia
+template<typename T>
+bool structures::BlockingQueue<T>::push(const T& data) {
+    return emplace(data);
+}
+
+// Enfileira movendo o elemento, esperando enquanto a fila estiver cheia
+template<typename T>
+bool structures::BlockingQueue<T>::push(T&& data) {
+    return emplace(std::move(data));
+}
+
+// Constrói um elemento no fim da fila, esperando enquanto ela estiver cheia
+template<typename T>
+template<typename... Args>
+bool structures::BlockingQueue<T>::emplace(Args&&... args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!closed_ && queue_.full()) {
+        waiting_producers_++;
+        not_full_.wait(lock);
+        waiting_producers_--;
+    }
+    if (closed_) {
+        return false;
+    }
+    queue_.emplace(std::forward<Args>(args)...);
+    wake_consumers(lock, 1);
+    return true;
+}
+
+// Enfileira uma cópia do elemento se houver espaço
+template<typename T>
+bool structures::BlockingQueue<T>::try_push(const T& data) {
+    return try_emplace(data);
+}
+
+// Enfileira movendo o elemento se houver espaço
+template<typename T>
+bool structures::BlockingQueue<T>::try_push(T&& data) {
+    return try_emplace(std::move(data));
+}
+
+// Constrói um elemento no fim da fila se houver espaço ('args' só é
+// consumido se o elemento entrar)
+template<typename T>
+template<typename... Args>
+bool structures::BlockingQueue<T>::try_emplace(Args&&... args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closed_ || queue_.full()) {
+        return false;
+    }
+    queue_.emplace(std::forward<Args>(args)...);
+    wake_consumers(lock, 1);
+    return true;
+}
+
+// Enfileira 'count' elementos em blocos, esperando espaço entre os blocos
+template<typename T>
+std::size_t structures::BlockingQueue<T>::push_bulk(const T* first,
+std::size_t count) {
+    std::size_t pushed = 0;
+    while (pushed < count) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!closed_ && queue_.full()) {
+            waiting_producers_++;
+            not_full_.wait(lock);
+            waiting_producers_--;
+        }
+        if (closed_) {
+            break;
+        }
+        std::size_t n = queue_.enqueue_bulk(first + pushed, count - pushed);
+        pushed += n;
+        wake_consumers(lock, n);
+    }
+    return pushed;
+}
+
+// Desenfileira um elemento, esperando enquanto a fila estiver vazia
+template<typename T>
+bool structures::BlockingQueue<T>::pop(T& data) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!closed_ && queue_.empty()) {
+        waiting_consumers_++;
+        not_empty_.wait(lock);
+        waiting_consumers_--;
+    }
+    if (queue_.empty()) {
+        return false;  // fechada e vazia
+    }
+    queue_.dequeue_into(data);
+    wake_producers(lock, 1);
+    return true;
+}
+
+// Desenfileira um elemento se houver
+template<typename T>
+bool structures::BlockingQueue<T>::try_pop(T& data) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+        return false;
+    }
+    queue_.dequeue_into(data);
+    wake_producers(lock, 1);
+    return true;
+}
+
+// Desenfileira um elemento, esperando no máximo 'timeout'
+template<typename T>
+template<typename Rep, typename Period>
+bool structures::BlockingQueue<T>::try_pop_for(T& data,
+const std::chrono::duration<Rep, Period>& timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!closed_ && queue_.empty()) {
+        waiting_consumers_++;
+        not_empty_.wait_for(lock, timeout, [this] {
+            return closed_ || !queue_.empty();
+        });
+        waiting_consumers_--;
+    }
+    if (queue_.empty()) {
+        return false;
+    }
+    queue_.dequeue_into(data);
+    wake_producers(lock, 1);
+    return true;
+}
+
+// Espera ao menos um elemento e retira até 'max' de uma vez
+template<typename T>
+std::size_t structures::BlockingQueue<T>::pop_bulk(T* out, std::size_t max) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!closed_ && queue_.empty()) {
+        waiting_consumers_++;
+        not_empty_.wait(lock);
+        waiting_consumers_--;
+    }
+    std::size_t n = queue_.dequeue_bulk(out, max);
+    wake_producers(lock, n);
+    return n;
+}
+
+// Fecha a fila: pushes passam a falhar e todas as esperas terminam
+template<typename T>
+void structures::BlockingQueue<T>::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+}
+
+// Verifica se a fila foi fechada
+template<typename T>
+bool structures::BlockingQueue<T>::closed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+}
+
+// Consulta o tamanho da fila
+template<typename T>
+std::size_t structures::BlockingQueue<T>::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+// Consulta o tamanho máximo da fila
+template<typename T>
+std::size_t structures::BlockingQueue<T>::max_size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.max_size();
+}
+
+// Consulta a origem da memória da fila
+template<typename T>
+std::pmr::memory_resource* structures::BlockingQueue<T>::resource() const {
+    return queue_.resource();
+}
+
+// Solta a trava e acorda consumidores para 'count' elementos novos, se
+// houver algum esperando (a notificação vem depois de soltar a trava, para
+// quem acorda não bloquear nela)
+template<typename T>
+void structures::BlockingQueue<T>::wake_consumers(
+std::unique_lock<std::mutex>& lock, std::size_t count) {
+    bool waiting = waiting_consumers_ > 0;
+    lock.unlock();
+    if (!waiting || count == 0) {
+        return;
+    }
+    if (count == 1) {
+        not_empty_.notify_one();
+    } else {
+        not_empty_.notify_all();
+    }
+}
+
+// Solta a trava e acorda produtores para 'count' posições livres, se
+// houver algum esperando
+template<typename T>
+void structures::BlockingQueue<T>::wake_producers(
+std::unique_lock<std::mutex>& lock, std::size_t count) {
+    bool waiting = waiting_producers_ > 0;
+    lock.unlock();
+    if (!waiting || count == 0) {
+        return;
+    }
+    if (count == 1) {
+        not_full_.notify_one();
+    } else {
+        not_full_.notify_all();
+    }
+}
+
+#endif
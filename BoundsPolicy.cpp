@@ -0,0 +1,51 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_BOUNDS_POLICY_H
+#define STRUCTURES_BOUNDS_POLICY_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace structures {
+
+//! Políticas de verificação de limites das listas. Cada uma tem
+//!     static void require(bool condition, const char* message);
+//! chamada antes de acessar uma posição ou retirar um elemento. A política
+//! é parâmetro de template, então a verificação desaparece do código
+//! gerado quando não é usada.
+namespace bounds {
+
+//! Lança std::out_of_range (o comportamento padrão)
+struct checked {
+    static void require(bool condition, const char* message) {
+        if (!condition) {
+            throw std::out_of_range(message);
+        }
+    }
+};
+
+//! Aborta com a mensagem em builds de debug; sem efeito com NDEBUG
+struct debug_assert {
+    static void require(bool condition, const char* message) {
+#ifndef NDEBUG
+        if (!condition) {
+            std::fprintf(stderr, "structures: %s\n", message);
+            std::abort();
+        }
+#else
+        (void)condition;
+        (void)message;
+#endif
+    }
+};
+
+//! Não verifica nada: acessos fora dos limites são comportamento indefinido
+struct unchecked {
+    static void require(bool, const char*) {}
+};
+
+}  // namespace bounds
+
+}  // namespace structures
+
+#endif
@@ -1,12 +1,22 @@
 //! Copyright [2022] <Lucas Castro Truppel Machado>
-#ifndef STRUCTURES_LINKED_LIST_H
-#define STRUCTURES_LINKED_LIST_H
+#ifndef STRUCTURES_DOUBLY_CIRCULAR_LIST_H
+#define STRUCTURES_DOUBLY_CIRCULAR_LIST_H
 
 #include <cstdint>
+#include <istream>
+#include <memory_resource>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+
+#include "./BoundsPolicy.cpp"
+#include "./Serialization.cpp"
 
 namespace structures {
 
-template<typename T>
+// Bounds: verificação de limites (bounds::checked, debug_assert ou
+// unchecked, em BoundsPolicy.cpp)
+template<typename T, typename Bounds = bounds::checked>
 class DoublyCircularList {
  private:
     class Node {
@@ -36,9 +46,15 @@ class DoublyCircularList {
 
     Node* head;
     std::size_t size_;
+    std::pmr::memory_resource* resource_;
+
+    Node* create_node(const T& data);  // aloca um nodo em 'resource_'
+    void destroy_node(Node* node);  // devolve um nodo para 'resource_'
 
  public:
     DoublyCircularList();
+    explicit DoublyCircularList(
+        const std::pmr::polymorphic_allocator<T>& allocator);
     ~DoublyCircularList();
 
     void clear();
@@ -63,6 +79,9 @@ class DoublyCircularList {
 
     std::size_t find(const T& data) const;  // posição de um dado
     std::size_t size() const;  // tamanho
+    std::pmr::memory_resource* resource() const;  // origem da memória
+    void save(std::ostream& out) const;  // grava (Serialization.cpp)
+    void load(std::istream& in);  // substitui pelo conteúdo lido
 };
 
 }  // namespace structures
@@ -70,24 +89,25 @@ class DoublyCircularList {
 // Node
 
 // Construtor padrão
-template<typename T>
-structures::DoublyCircularList<T>::Node::Node(const T& data) {
+template<typename T, typename Bounds>
+structures::DoublyCircularList<T, Bounds>::Node::Node(const T& data) {
     data_ = data;
     prev_= nullptr;
     next_ = nullptr;
 }
 
 // Construtor com next
-template<typename T>
-structures::DoublyCircularList<T>::Node::Node(const T& data, Node* next) {
+template<typename T, typename Bounds>
+structures::DoublyCircularList<T, Bounds>::Node::Node(const T& data,
+Node* next) {
     data_ = data;
     prev_= nullptr;
     next_ = next;
 }
 
 // Construtor com prev e next
-template<typename T>
-structures::DoublyCircularList<T>::Node::Node(const T& data, Node* prev,
+template<typename T, typename Bounds>
+structures::DoublyCircularList<T, Bounds>::Node::Node(const T& data, Node* prev,
 Node* next) {
     data_ = data;
     prev_= prev;
@@ -95,85 +115,95 @@ Node* next) {
 }
 
 // Getter: dado
-template<typename T>
-T& structures::DoublyCircularList<T>::Node::data() {
+template<typename T, typename Bounds>
+T& structures::DoublyCircularList<T, Bounds>::Node::data() {
     return data_;
 }
 
 // Getter const: dado
-template<typename T>
-const T& structures::DoublyCircularList<T>::Node::data() const {
+template<typename T, typename Bounds>
+const T& structures::DoublyCircularList<T, Bounds>::Node::data() const {
     return data_;
 }
 
 // Getter: anterior
-template<typename T>
-typename structures::DoublyCircularList<T>::Node*
-structures::DoublyCircularList<T>::Node::prev() {
+template<typename T, typename Bounds>
+typename structures::DoublyCircularList<T, Bounds>::Node*
+structures::DoublyCircularList<T, Bounds>::Node::prev() {
     return prev_;
 }
 
 // Getter const: anterior
-template<typename T>
-const typename structures::DoublyCircularList<T>::Node*
-structures::DoublyCircularList<T>::Node::prev() const {
+template<typename T, typename Bounds>
+const typename structures::DoublyCircularList<T, Bounds>::Node*
+structures::DoublyCircularList<T, Bounds>::Node::prev() const {
     return prev_;
 }
 
 // Setter: anterior
-template<typename T>
-void structures::DoublyCircularList<T>::Node::prev(Node* node) {
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::Node::prev(Node* node) {
     prev_ = node;
 }
 
 // Getter: próximo
-template<typename T>
-typename structures::DoublyCircularList<T>::Node*
-structures::DoublyCircularList<T>::Node::next() {
+template<typename T, typename Bounds>
+typename structures::DoublyCircularList<T, Bounds>::Node*
+structures::DoublyCircularList<T, Bounds>::Node::next() {
     return next_;
 }
 
 // Getter const: próximo
-template<typename T>
-const typename structures::DoublyCircularList<T>::Node*
-structures::DoublyCircularList<T>::Node::next() const {
+template<typename T, typename Bounds>
+const typename structures::DoublyCircularList<T, Bounds>::Node*
+structures::DoublyCircularList<T, Bounds>::Node::next() const {
     return next_;
 }
 
 // Setter: próximo
-template<typename T>
-void structures::DoublyCircularList<T>::Node::next(Node* node) {
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::Node::next(Node* node) {
     next_ = node;
 }
 
 // DoublyCircularList
 
 // Construtor
-template<typename T>
-structures::DoublyCircularList<T>::DoublyCircularList() {
+template<typename T, typename Bounds>
+structures::DoublyCircularList<T, Bounds>::DoublyCircularList() {
     head = nullptr;
     size_ = 0u;
+    resource_ = std::pmr::get_default_resource();
+}
+
+// Construtor com os nodos vindos de 'allocator'
+template<typename T, typename Bounds>
+structures::DoublyCircularList<T, Bounds>::DoublyCircularList(
+const std::pmr::polymorphic_allocator<T>& allocator) {
+    head = nullptr;
+    size_ = 0u;
+    resource_ = allocator.resource();
 }
 
 // Destrutor
-template<typename T>
-structures::DoublyCircularList<T>::~DoublyCircularList() {
+template<typename T, typename Bounds>
+structures::DoublyCircularList<T, Bounds>::~DoublyCircularList() {
     clear();
 }
 
 // Limpa a lista
-template<typename T>
-void structures::DoublyCircularList<T>::clear() {
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::clear() {
     while (!empty()) {
         pop_back();
     }
 }
 
 // Insere um dado no fim da lista
-template<typename T>
-void structures::DoublyCircularList<T>::push_back(const T& data) {
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::push_back(const T& data) {
     Node* novo;
-    novo = new Node(data);
+    novo = create_node(data);
     if (novo == nullptr) {
         throw std::out_of_range("no memory available");
     }
@@ -191,10 +221,10 @@ void structures::DoublyCircularList<T>::push_back(const T& data) {
 }
 
 // Insere um dado no início da lista
-template<typename T>
-void structures::DoublyCircularList<T>::push_front(const T& data) {
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::push_front(const T& data) {
     Node* novo;
-    novo = new Node(data);
+    novo = create_node(data);
     if (novo == nullptr) {
         throw std::out_of_range("no memory available");
     }
@@ -212,18 +242,17 @@ void structures::DoublyCircularList<T>::push_front(const T& data) {
 }
 
 // Insere um dado em uma posição específica
-template<typename T>
-void structures::DoublyCircularList<T>::insert(const T& data, std::size_t index) {
-    if (index > size()) {
-        throw std::out_of_range("invalid index");
-    }    
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::insert(const T& data,
+std::size_t index) {
+    Bounds::require(index <= size(), "invalid index");
     if (index == 0) {
         push_front(data);
     } else if (index == size_) {
         push_back(data);
     } else {
         Node* novo;
-        novo = new Node(data);        
+        novo = create_node(data);
         Node* prev_node = at_pointer(index-1);
         (prev_node->next())->prev(novo);
         novo->next(prev_node->next());
@@ -234,8 +263,8 @@ void structures::DoublyCircularList<T>::insert(const T& data, std::size_t index)
 }
 
 // Insere um dado na lista de forma ordenada
-template<typename T>
-void structures::DoublyCircularList<T>::insert_sorted(const T& data) {
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::insert_sorted(const T& data) {
     Node* current_node = head;
     std::size_t index = size_;
     for (std::size_t i = 0; i < size_; i++) {
@@ -250,14 +279,10 @@ void structures::DoublyCircularList<T>::insert_sorted(const T& data) {
 }
 
 // Retira um elemento de uma posição específica
-template<typename T>
-T structures::DoublyCircularList<T>::pop(std::size_t index) {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
-    if (index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+T structures::DoublyCircularList<T, Bounds>::pop(std::size_t index) {
+    Bounds::require(!empty(), "the list is empty");
+    Bounds::require(index < size_, "invalid index");
     T data;
     if (index == 0) {
         data = pop_front();
@@ -268,18 +293,16 @@ T structures::DoublyCircularList<T>::pop(std::size_t index) {
         (current->prev())->next(current->next());
         (current->next())->prev(current->prev());
         data = current->data();
-        delete current;
+        destroy_node(current);
         size_--;
     }
     return data;
 }
 
 // Retira o último elemento da lista
-template<typename T>
-T structures::DoublyCircularList<T>::pop_back() {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+T structures::DoublyCircularList<T, Bounds>::pop_back() {
+    Bounds::require(!empty(), "the list is empty");
     T data;
     Node* old_tail = head->prev();
     if (size_ == 1) {
@@ -289,17 +312,15 @@ T structures::DoublyCircularList<T>::pop_back() {
         head->prev(old_tail->prev());
     }
     data = old_tail->data();
-    delete old_tail;
+    destroy_node(old_tail);
     size_--;
     return data;
 }
 
 // Retira o primeiro elemento da lista
-template<typename T>
-T structures::DoublyCircularList<T>::pop_front() {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+T structures::DoublyCircularList<T, Bounds>::pop_front() {
+    Bounds::require(!empty(), "the list is empty");
     Node* old_head = head;
     if (size_ == 1) {
         head = nullptr;
@@ -309,41 +330,35 @@ T structures::DoublyCircularList<T>::pop_front() {
         (old_head->prev())->next(head);
     }
     T data = old_head->data();
-    delete old_head;
+    destroy_node(old_head);
     size_--;
     return data;
 }
 
 // Retira um elemento dado um ponteiro
-template<typename T>
-T structures::DoublyCircularList<T>::pop_pointer(Node* current) {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
-    if (current == nullptr) {
-        throw std::out_of_range("pointer is nullptr");
-    }
+template<typename T, typename Bounds>
+T structures::DoublyCircularList<T, Bounds>::pop_pointer(Node* current) {
+    Bounds::require(!empty(), "the list is empty");
+    Bounds::require(current != nullptr, "pointer is nullptr");
     T data;
     if (current == head) {
         data = pop_front();
-    } else if (current == tail) {
+    } else if (current == head->prev()) {
         data = pop_back();
     } else {
         (current->prev())->next(current->next());
         (current->next())->prev(current->prev());
         data = current->data();
-        delete current;
+        destroy_node(current);
         size_--;
     }
     return data;
 }
 
 // Remove um valor específico da lista na sua primeira aparição
-template<typename T>
-void structures::DoublyCircularList<T>::remove(const T& data) {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::remove(const T& data) {
+    Bounds::require(!empty(), "the list is empty");
     Node* current = head;
     for (std::size_t i = 0; i < size_; i++) {
         if (current->data() == data) {
@@ -356,8 +371,8 @@ void structures::DoublyCircularList<T>::remove(const T& data) {
 }
 
 // Verifica se a lista está vazia
-template<typename T>
-bool structures::DoublyCircularList<T>::empty() const {
+template<typename T, typename Bounds>
+bool structures::DoublyCircularList<T, Bounds>::empty() const {
     if (size_ == 0) {
         return true;
     } else {
@@ -366,26 +381,24 @@ bool structures::DoublyCircularList<T>::empty() const {
 }
 
 // Verifica se a lista contém um dado
-template<typename T>
-bool structures::DoublyCircularList<T>::contains(const T& data) const {
+template<typename T, typename Bounds>
+bool structures::DoublyCircularList<T, Bounds>::contains(const T& data) const {
     Node* current = head;
     bool contain = false;
-    for (std::size_t i = 0; i < size_; -++) {
-         if (current->data() == data) {
+    for (std::size_t i = 0; i < size_; i++) {
+        if (current->data() == data) {
             contain = true;
             break;
         }
-        current = current->next();       
+        current = current->next();
     }
     return contain;
 }
 
 // Acessa o dado de uma posição específica
-template<typename T>
-T& structures::DoublyCircularList<T>::at(std::size_t index) {
-    if (empty() || index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+T& structures::DoublyCircularList<T, Bounds>::at(std::size_t index) {
+    Bounds::require(!empty() && index < size_, "invalid index");
     Node* current_node;
     if (index < size_ / 2) {
         current_node = head;
@@ -402,11 +415,10 @@ T& structures::DoublyCircularList<T>::at(std::size_t index) {
 }
 
 // Acessa o dado de uma posição específica constante
-template<typename T>
-const T& structures::DoublyCircularList<T>::at(std::size_t index) const {
-    if (empty() || index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+const T&
+structures::DoublyCircularList<T, Bounds>::at(std::size_t index) const {
+    Bounds::require(!empty() && index < size_, "invalid index");
     Node* current_node;
     if (index < size_ / 2) {
         current_node = head;
@@ -423,12 +435,10 @@ const T& structures::DoublyCircularList<T>::at(std::size_t index) const {
 }
 
 // Acessa o ponteiro de uma posição específica
-template<typename T>
-typename structures::DoublyCircularList<T>::Node*
-structures::DoublyCircularList<T>::at_pointer(std::size_t index) {
-    if (empty() || index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+typename structures::DoublyCircularList<T, Bounds>::Node*
+structures::DoublyCircularList<T, Bounds>::at_pointer(std::size_t index) {
+    Bounds::require(!empty() && index < size_, "invalid index");
     Node* current_node;
     if (index < size_ / 2) {
         current_node = head;
@@ -445,8 +455,9 @@ structures::DoublyCircularList<T>::at_pointer(std::size_t index) {
 }
 
 // Verifica o index da primeira aparição de um dado
-template<typename T>
-std::size_t structures::DoublyCircularList<T>::find(const T& data) const {
+template<typename T, typename Bounds>
+std::size_t
+structures::DoublyCircularList<T, Bounds>::find(const T& data) const {
     Node* current = head;
     std::size_t index;
     for (index = 0; index < size_; index++) {
@@ -459,9 +470,57 @@ std::size_t structures::DoublyCircularList<T>::find(const T& data) const {
 }
 
 // Retorna o tamanho da lista
-template<typename T>
-std::size_t structures::DoublyCircularList<T>::size() const {
+template<typename T, typename Bounds>
+std::size_t structures::DoublyCircularList<T, Bounds>::size() const {
     return size_;
 }
 
-#endif
\ No newline at end of file
+// Retorna a origem da memória dos nodos
+template<typename T, typename Bounds>
+std::pmr::memory_resource*
+structures::DoublyCircularList<T, Bounds>::resource() const {
+    return resource_;
+}
+
+// Grava a lista em 'out', percorrendo os nodos uma única vez
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::save(std::ostream& out) const {
+    serialization::write_header<T>(out, size_);
+    const Node* current = head;
+    for (std::size_t i = 0; i < size_; i++) {
+        serialization::write_element(out, current->data());
+        current = current->next();
+    }
+}
+
+// Substitui o conteúdo da lista pela sequência lida de 'in'
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::load(std::istream& in) {
+    std::uint64_t count = serialization::read_header<T>(in);
+    clear();
+    for (std::uint64_t i = 0; i < count; i++) {
+        push_back(serialization::read_element<T>(in));
+    }
+}
+
+// Aloca e constrói um nodo em 'resource_'
+template<typename T, typename Bounds>
+typename structures::DoublyCircularList<T, Bounds>::Node*
+structures::DoublyCircularList<T, Bounds>::create_node(const T& data) {
+    void* raw = resource_->allocate(sizeof(Node), alignof(Node));
+    try {
+        return new (raw) Node(data);
+    } catch (...) {
+        resource_->deallocate(raw, sizeof(Node), alignof(Node));
+        throw;
+    }
+}
+
+// Destrói um nodo e devolve sua memória para 'resource_'
+template<typename T, typename Bounds>
+void structures::DoublyCircularList<T, Bounds>::destroy_node(Node* node) {
+    node->~Node();
+    resource_->deallocate(node, sizeof(Node), alignof(Node));
+}
+
+#endif
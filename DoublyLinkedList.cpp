@@ -1,12 +1,22 @@
 //! Copyright [2022] <Lucas Castro Truppel Machado>
-#ifndef STRUCTURES_LINKED_LIST_H
-#define STRUCTURES_LINKED_LIST_H
+#ifndef STRUCTURES_DOUBLY_LINKED_LIST_H
+#define STRUCTURES_DOUBLY_LINKED_LIST_H
 
 #include <cstdint>
+#include <istream>
+#include <memory_resource>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+
+#include "./BoundsPolicy.cpp"
+#include "./Serialization.cpp"
 
 namespace structures {
 
-template<typename T>
+// Bounds: verificação de limites (bounds::checked, debug_assert ou
+// unchecked, em BoundsPolicy.cpp)
+template<typename T, typename Bounds = bounds::checked>
 class DoublyLinkedList {
  private:
     class Node {  // implementar cada um dos métodos de Node
@@ -36,6 +46,8 @@ class DoublyLinkedList {
 
  public:
     DoublyLinkedList();
+    explicit DoublyLinkedList(
+        const std::pmr::polymorphic_allocator<T>& allocator);
     ~DoublyLinkedList();
     void clear();
 
@@ -59,10 +71,19 @@ class DoublyLinkedList {
 
     std::size_t find(const T& data) const;  // posição de um dado
     std::size_t size() const;  // tamanho
+    std::pmr::memory_resource* resource() const;  // origem da memória
+    void save(std::ostream& out) const;  // grava (Serialization.cpp)
+    void load(std::istream& in);  // substitui pelo conteúdo lido
 
     Node* head;  // primeiro da lista
     Node* tail;  // ultimo da lista
     std::size_t size_;
+
+ private:
+    Node* create_node(const T& data);  // aloca um nodo em 'resource_'
+    void destroy_node(Node* node);  // devolve um nodo para 'resource_'
+
+    std::pmr::memory_resource* resource_;
 };
 
 }  // namespace structures
@@ -70,24 +91,24 @@ class DoublyLinkedList {
 // Node
 
 // Construtor padrão
-template<typename T>
-structures::DoublyLinkedList<T>::Node::Node(const T& data) {
+template<typename T, typename Bounds>
+structures::DoublyLinkedList<T, Bounds>::Node::Node(const T& data) {
     data_ = data;
     prev_= nullptr;
     next_ = nullptr;
 }
 
 // Construtor com next
-template<typename T>
-structures::DoublyLinkedList<T>::Node::Node(const T& data, Node* next) {
+template<typename T, typename Bounds>
+structures::DoublyLinkedList<T, Bounds>::Node::Node(const T& data, Node* next) {
     data_ = data;
     prev_= nullptr;
     next_ = next;
 }
 
 // Construtor com prev e next
-template<typename T>
-structures::DoublyLinkedList<T>::Node::Node(const T& data, Node* prev,
+template<typename T, typename Bounds>
+structures::DoublyLinkedList<T, Bounds>::Node::Node(const T& data, Node* prev,
 Node* next) {
     data_ = data;
     prev_= prev;
@@ -95,86 +116,97 @@ Node* next) {
 }
 
 // Getter: dado
-template<typename T>
-T& structures::DoublyLinkedList<T>::Node::data() {
+template<typename T, typename Bounds>
+T& structures::DoublyLinkedList<T, Bounds>::Node::data() {
     return data_;
 }
 
 // Getter const: dado
-template<typename T>
-const T& structures::DoublyLinkedList<T>::Node::data() const {
+template<typename T, typename Bounds>
+const T& structures::DoublyLinkedList<T, Bounds>::Node::data() const {
     return data_;
 }
 
 // Getter: anterior
-template<typename T>
-typename structures::DoublyLinkedList<T>::Node*
-structures::DoublyLinkedList<T>::Node::prev() {
+template<typename T, typename Bounds>
+typename structures::DoublyLinkedList<T, Bounds>::Node*
+structures::DoublyLinkedList<T, Bounds>::Node::prev() {
     return prev_;
 }
 
 // Getter const: anterior
-template<typename T>
-const typename structures::DoublyLinkedList<T>::Node*
-structures::DoublyLinkedList<T>::Node::prev() const {
+template<typename T, typename Bounds>
+const typename structures::DoublyLinkedList<T, Bounds>::Node*
+structures::DoublyLinkedList<T, Bounds>::Node::prev() const {
     return prev_;
 }
 
 // Setter: anterior
-template<typename T>
-void structures::DoublyLinkedList<T>::Node::prev(Node* node) {
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::Node::prev(Node* node) {
     prev_ = node;
 }
 
 // Getter: próximo
-template<typename T>
-typename structures::DoublyLinkedList<T>::Node*
-structures::DoublyLinkedList<T>::Node::next() {
+template<typename T, typename Bounds>
+typename structures::DoublyLinkedList<T, Bounds>::Node*
+structures::DoublyLinkedList<T, Bounds>::Node::next() {
     return next_;
 }
 
 // Getter const: próximo
-template<typename T>
-const typename structures::DoublyLinkedList<T>::Node*
-structures::DoublyLinkedList<T>::Node::next() const {
+template<typename T, typename Bounds>
+const typename structures::DoublyLinkedList<T, Bounds>::Node*
+structures::DoublyLinkedList<T, Bounds>::Node::next() const {
     return next_;
 }
 
 // Setter: próximo
-template<typename T>
-void structures::DoublyLinkedList<T>::Node::next(Node* node) {
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::Node::next(Node* node) {
     next_ = node;
 }
 
 // DoublyLinkedList
 
 // Construtor
-template<typename T>
-structures::DoublyLinkedList<T>::DoublyLinkedList() {
+template<typename T, typename Bounds>
+structures::DoublyLinkedList<T, Bounds>::DoublyLinkedList() {
+    head = nullptr;
+    tail = nullptr;
+    size_ = 0u;
+    resource_ = std::pmr::get_default_resource();
+}
+
+// Construtor com os nodos vindos de 'allocator'
+template<typename T, typename Bounds>
+structures::DoublyLinkedList<T, Bounds>::DoublyLinkedList(
+const std::pmr::polymorphic_allocator<T>& allocator) {
     head = nullptr;
     tail = nullptr;
     size_ = 0u;
+    resource_ = allocator.resource();
 }
 
 // Destrutor
-template<typename T>
-structures::DoublyLinkedList<T>::~DoublyLinkedList() {
+template<typename T, typename Bounds>
+structures::DoublyLinkedList<T, Bounds>::~DoublyLinkedList() {
     clear();
 }
 
 // Limpa a lista
-template<typename T>
-void structures::DoublyLinkedList<T>::clear() {
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::clear() {
     while (!empty()) {
         pop_back();
     }
 }
 
 // Insere um dado no fim da lista
-template<typename T>
-void structures::DoublyLinkedList<T>::push_back(const T& data) {
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::push_back(const T& data) {
     Node* novo;
-    novo = new Node(data);
+    novo = create_node(data);
     if (novo == nullptr) {
         throw std::out_of_range("no memory available");
     }
@@ -190,10 +222,10 @@ void structures::DoublyLinkedList<T>::push_back(const T& data) {
 }
 
 // Insere um dado no início da lista
-template<typename T>
-void structures::DoublyLinkedList<T>::push_front(const T& data) {
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::push_front(const T& data) {
     Node* novo;
-    novo = new Node(data);
+    novo = create_node(data);
     if (novo == nullptr) {
         throw std::out_of_range("no memory available");
     }
@@ -209,18 +241,17 @@ void structures::DoublyLinkedList<T>::push_front(const T& data) {
 }
 
 // Insere um dado em uma posição específica da lista
-template<typename T>
-void structures::DoublyLinkedList<T>::insert(const T& data, std::size_t index) {
-    if (index > size()) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::insert(const T& data,
+std::size_t index) {
+    Bounds::require(index <= size(), "invalid index");
     if (index == 0) {
         push_front(data);
     } else if (index == size_) {
         push_back(data);
     } else {
         Node* novo;
-        novo = new Node(data);
+        novo = create_node(data);
         if (novo == nullptr) {
             throw std::out_of_range("no memory available");
         }
@@ -234,8 +265,8 @@ void structures::DoublyLinkedList<T>::insert(const T& data, std::size_t index) {
 }
 
 // Insere um dado na lista de forma ordenada
-template<typename T>
-void structures::DoublyLinkedList<T>::insert_sorted(const T& data) {
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::insert_sorted(const T& data) {
     Node* current_node = head;
     std::size_t index = size_;
     for (std::size_t i = 0; i < size_; i++) {
@@ -250,14 +281,10 @@ void structures::DoublyLinkedList<T>::insert_sorted(const T& data) {
 }
 
 // Retira um elemento de uma posição específica
-template<typename T>
-T structures::DoublyLinkedList<T>::pop(std::size_t index) {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
-    if (index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+T structures::DoublyLinkedList<T, Bounds>::pop(std::size_t index) {
+    Bounds::require(!empty(), "the list is empty");
+    Bounds::require(index < size_, "invalid index");
     T data;
     if (index == 0) {
         data = pop_front();
@@ -268,18 +295,16 @@ T structures::DoublyLinkedList<T>::pop(std::size_t index) {
         (current->prev())->next(current->next());
         (current->next())->prev(current->prev());
         data = current->data();
-        delete current;
+        destroy_node(current);
         size_--;
     }
     return data;
 }
 
 // Retira o último elemento da lista
-template<typename T>
-T structures::DoublyLinkedList<T>::pop_back() {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+T structures::DoublyLinkedList<T, Bounds>::pop_back() {
+    Bounds::require(!empty(), "the list is empty");
     T data;
     Node* old_tail = tail;
     if (size_ == 1) {
@@ -290,17 +315,15 @@ T structures::DoublyLinkedList<T>::pop_back() {
         tail->next(nullptr);
     }
     data = old_tail->data();
-    delete old_tail;
+    destroy_node(old_tail);
     size_--;
     return data;
 }
 
 // Retira o primeiro elemento da lista
-template<typename T>
-T structures::DoublyLinkedList<T>::pop_front() {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+T structures::DoublyLinkedList<T, Bounds>::pop_front() {
+    Bounds::require(!empty(), "the list is empty");
     Node* old_head = head;
     if (size_ == 1) {
         head = nullptr;
@@ -310,20 +333,16 @@ T structures::DoublyLinkedList<T>::pop_front() {
         head->prev(nullptr);
     }
     T data = old_head->data();
-    delete old_head;
+    destroy_node(old_head);
     size_--;
     return data;
 }
 
 // Retira um elemento dado um ponteiro
-template<typename T>
-T structures::DoublyLinkedList<T>::pop_pointer(Node* current) {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
-    if (current == nullptr) {
-        throw std::out_of_range("pointer is nullptr");
-    }
+template<typename T, typename Bounds>
+T structures::DoublyLinkedList<T, Bounds>::pop_pointer(Node* current) {
+    Bounds::require(!empty(), "the list is empty");
+    Bounds::require(current != nullptr, "pointer is nullptr");
     T data;
     if (current == head) {
         data = pop_front();
@@ -333,18 +352,16 @@ T structures::DoublyLinkedList<T>::pop_pointer(Node* current) {
         (current->prev())->next(current->next());
         (current->next())->prev(current->prev());
         data = current->data();
-        delete current;
+        destroy_node(current);
         size_--;
     }
     return data;
 }
 
 // Remove um valor específico da lista na sua primeira aparição
-template<typename T>
-void structures::DoublyLinkedList<T>::remove(const T& data) {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::remove(const T& data) {
+    Bounds::require(!empty(), "the list is empty");
     Node* current = head;
     for (std::size_t i = 0; i < size_; i++) {
         if (current->data() == data) {
@@ -357,8 +374,8 @@ void structures::DoublyLinkedList<T>::remove(const T& data) {
 }
 
 // Verifica se a lista está vazia
-template<typename T>
-bool structures::DoublyLinkedList<T>::empty() const {
+template<typename T, typename Bounds>
+bool structures::DoublyLinkedList<T, Bounds>::empty() const {
     if (size_ == 0) {
         return true;
     } else {
@@ -367,8 +384,8 @@ bool structures::DoublyLinkedList<T>::empty() const {
 }
 
 // Verifica se a lista contém um dado
-template<typename T>
-bool structures::DoublyLinkedList<T>::contains(const T& data) const {
+template<typename T, typename Bounds>
+bool structures::DoublyLinkedList<T, Bounds>::contains(const T& data) const {
     Node* current = head;
     bool contain = false;
     while (current != nullptr) {
@@ -382,11 +399,9 @@ bool structures::DoublyLinkedList<T>::contains(const T& data) const {
 }
 
 // Acessa o dado de uma posição específica
-template<typename T>
-T& structures::DoublyLinkedList<T>::at(std::size_t index) {
-    if (empty() || index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+T& structures::DoublyLinkedList<T, Bounds>::at(std::size_t index) {
+    Bounds::require(!empty() && index < size_, "invalid index");
     Node* current_node;
     if (index < size_ / 2) {
         current_node = head;
@@ -403,11 +418,9 @@ T& structures::DoublyLinkedList<T>::at(std::size_t index) {
 }
 
 // Acessa o dado de uma posição específica constante
-template<typename T>
-const T& structures::DoublyLinkedList<T>::at(std::size_t index) const {
-    if (empty() || index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+const T& structures::DoublyLinkedList<T, Bounds>::at(std::size_t index) const {
+    Bounds::require(!empty() && index < size_, "invalid index");
     Node* current_node;
     if (index < size_ / 2) {
         current_node = head;
@@ -424,12 +437,10 @@ const T& structures::DoublyLinkedList<T>::at(std::size_t index) const {
 }
 
 // Acessa o ponteiro de uma posição específica
-template<typename T>
-typename structures::DoublyLinkedList<T>::Node*
-structures::DoublyLinkedList<T>::at_pointer(std::size_t index) {
-    if (empty() || index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+typename structures::DoublyLinkedList<T, Bounds>::Node*
+structures::DoublyLinkedList<T, Bounds>::at_pointer(std::size_t index) {
+    Bounds::require(!empty() && index < size_, "invalid index");
     Node* current_node;
     if (index < size_ / 2) {
         current_node = head;
@@ -446,8 +457,8 @@ structures::DoublyLinkedList<T>::at_pointer(std::size_t index) {
 }
 
 // Verifica o index da primeira aparição de um dado
-template<typename T>
-std::size_t structures::DoublyLinkedList<T>::find(const T& data) const {
+template<typename T, typename Bounds>
+std::size_t structures::DoublyLinkedList<T, Bounds>::find(const T& data) const {
     Node* current = head;
     std::size_t index = 0;
     while (current != nullptr) {
@@ -461,9 +472,56 @@ std::size_t structures::DoublyLinkedList<T>::find(const T& data) const {
 }
 
 // Verifica o tamanho da lista
-template<typename T>
-std::size_t structures::DoublyLinkedList<T>::size() const {
+template<typename T, typename Bounds>
+std::size_t structures::DoublyLinkedList<T, Bounds>::size() const {
     return size_;
 }
 
+// Retorna a origem da memória dos nodos
+template<typename T, typename Bounds>
+std::pmr::memory_resource*
+structures::DoublyLinkedList<T, Bounds>::resource() const {
+    return resource_;
+}
+
+// Grava a lista em 'out', percorrendo os nodos uma única vez
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::save(std::ostream& out) const {
+    serialization::write_header<T>(out, size_);
+    for (const Node* current = head; current != nullptr;
+         current = current->next()) {
+        serialization::write_element(out, current->data());
+    }
+}
+
+// Substitui o conteúdo da lista pela sequência lida de 'in'
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::load(std::istream& in) {
+    std::uint64_t count = serialization::read_header<T>(in);
+    clear();
+    for (std::uint64_t i = 0; i < count; i++) {
+        push_back(serialization::read_element<T>(in));
+    }
+}
+
+// Aloca e constrói um nodo em 'resource_'
+template<typename T, typename Bounds>
+typename structures::DoublyLinkedList<T, Bounds>::Node*
+structures::DoublyLinkedList<T, Bounds>::create_node(const T& data) {
+    void* raw = resource_->allocate(sizeof(Node), alignof(Node));
+    try {
+        return new (raw) Node(data);
+    } catch (...) {
+        resource_->deallocate(raw, sizeof(Node), alignof(Node));
+        throw;
+    }
+}
+
+// Destrói um nodo e devolve sua memória para 'resource_'
+template<typename T, typename Bounds>
+void structures::DoublyLinkedList<T, Bounds>::destroy_node(Node* node) {
+    node->~Node();
+    resource_->deallocate(node, sizeof(Node), alignof(Node));
+}
+
 #endif
@@ -0,0 +1,250 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_ELIMINATION_STACK_H
+#define STRUCTURES_ELIMINATION_STACK_H
+
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::size_t, std::uint64_t, std::uintptr_t
+#include <memory_resource>  // std::pmr::memory_resource
+#include <thread>  // std::this_thread::yield
+#include <type_traits>  // std::is_nothrow_move_assignable
+#include <utility>  // std::move, std::forward
+
+#include "./TreiberStack.cpp"
+
+namespace structures {
+
+template<typename T>
+//! TreiberStack com uma camada de eliminação (Hendler, Shavit e Yerushalmi).
+//! Quando o compare-exchange no topo falha por disputa, o push oferece o
+//! seu nó em uma posição aleatória de um vetor lateral e um pop que passe
+//! por lá leva o elemento direto, sem que nenhum dos dois toque no topo.
+//! O trecho do vetor usado cresce quando as posições estão disputadas e
+//! encolhe quando as ofertas expiram sem par.
+class EliminationStack : public TreiberStack<T> {
+    static_assert(std::is_nothrow_move_assignable<T>::value,
+                  "uma troca aceita não pode ficar pela metade");
+
+ public:
+    //! construtor simples
+    EliminationStack();
+    //! construtor com origem da memoria
+    explicit EliminationStack(
+        const std::pmr::polymorphic_allocator<T>& allocator);
+    //! empilha uma copia
+    void push(const T& data);
+    //! empilha movendo o dado
+    void push(T&& data);
+    //! constroi o elemento e o empilha (ou entrega a um pop)
+    template<typename... Args>
+    void emplace(Args&&... args);
+    //! move o topo (ou um push concorrente) para 'data'; false se vazia
+    bool try_pop(T& data);
+    //! operacoes que encontraram o topo disputado
+    std::uint64_t collisions() const;
+    //! operacoes concluidas por eliminacao (push e pop contam uma cada)
+    std::uint64_t eliminated() const;
+    //! tamanho atual do trecho usado do vetor de eliminacao
+    std::size_t range() const;
+
+ private:
+    using Node = typename TreiberStack<T>::Node;
+    using Attempt = typename TreiberStack<T>::Attempt;
+
+    // Estado de uma posição: 0 livre, o endereço do nó oferecido por um
+    // push, o endereço | 1 quando um pop aceitou a oferta e DONE quando o
+    // pop terminou de mover o elemento. Nós têm alinhamento de ao menos 4,
+    // então os dois bits baixos de um endereço são sempre 0.
+    struct alignas(CACHE_LINE) Exchanger {
+        std::atomic<std::uintptr_t> state{0u};
+    };
+
+    bool try_eliminate_push(std::uint32_t index);
+    bool try_eliminate_pop(T& data);
+    Exchanger& pick();
+    void grow();
+    void shrink();
+
+    static const std::uintptr_t CLAIMED = 1u;
+    static const std::uintptr_t DONE = 2u;
+    static const std::size_t SLOTS = 16u;
+    static const int SPINS = 64;  // espera por um par antes de desistir
+
+    Exchanger exchangers_[SLOTS];
+    alignas(CACHE_LINE) std::atomic<std::size_t> range_{1u};
+    alignas(CACHE_LINE) std::atomic<std::uint64_t> collisions_{0u};
+    std::atomic<std::uint64_t> eliminated_{0u};
+};
+
+}  // namespace structures
+
+// Construtor simples
+template<typename T>
+structures::EliminationStack<T>::EliminationStack() {
+}
+
+// Construtor com memória vinda de 'allocator'
+template<typename T>
+structures::EliminationStack<T>::EliminationStack(
+const std::pmr::polymorphic_allocator<T>& allocator):
+    TreiberStack<T>(allocator)
+{}
+
+// Empilha uma cópia do dado
+template<typename T>
+void structures::EliminationStack<T>::push(const T& data) {
+    emplace(data);
+}
+
+// Empilha movendo o dado
+template<typename T>
+void structures::EliminationStack<T>::push(T&& data) {
+    emplace(std::move(data));
+}
+
+// Constrói o elemento em um nó e alterna entre o topo e o vetor de
+// eliminação até um dos dois aceitar o nó
+template<typename T>
+template<typename... Args>
+void structures::EliminationStack<T>::emplace(Args&&... args) {
+    std::uint32_t index = this->make_node(std::forward<Args>(args)...);
+    while (!this->try_push_node(index)) {
+        collisions_.fetch_add(1, std::memory_order_relaxed);
+        if (try_eliminate_push(index)) {
+            return;
+        }
+    }
+}
+
+// Retira o topo, ou o elemento de um push concorrente se o topo estiver
+// disputado
+template<typename T>
+bool structures::EliminationStack<T>::try_pop(T& data) {
+    for (;;) {
+        Attempt attempt = this->try_pop_once(data);
+        if (attempt == Attempt::done) {
+            return true;
+        }
+        if (attempt == Attempt::empty) {
+            return false;
+        }
+        collisions_.fetch_add(1, std::memory_order_relaxed);
+        if (try_eliminate_pop(data)) {
+            return true;
+        }
+    }
+}
+
+// Consulta quantas operações encontraram o topo disputado
+template<typename T>
+std::uint64_t structures::EliminationStack<T>::collisions() const {
+    return collisions_.load(std::memory_order_relaxed);
+}
+
+// Consulta quantas operações terminaram por eliminação
+template<typename T>
+std::uint64_t structures::EliminationStack<T>::eliminated() const {
+    return eliminated_.load(std::memory_order_relaxed);
+}
+
+// Consulta o trecho usado do vetor de eliminação
+template<typename T>
+std::size_t structures::EliminationStack<T>::range() const {
+    return range_.load(std::memory_order_relaxed);
+}
+
+// Oferece o nó 'index' (índice + 1) em uma posição e espera um pop; true
+// se um pop levou o elemento (o nó volta para a lista livre)
+template<typename T>
+bool structures::EliminationStack<T>::try_eliminate_push(
+std::uint32_t index) {
+    Exchanger& exchanger = pick();
+    std::uintptr_t offer =
+        reinterpret_cast<std::uintptr_t>(this->node(index - 1));
+    std::uintptr_t expected = 0;
+    if (!exchanger.state.compare_exchange_strong(expected, offer,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed)) {
+        grow();  // posição ocupada: há mais disputa que posições
+        return false;
+    }
+    for (int i = 0; i < SPINS; i++) {
+        if (exchanger.state.load(std::memory_order_acquire) != offer) {
+            break;
+        }
+    }
+    expected = offer;
+    if (exchanger.state.compare_exchange_strong(expected, 0u,
+                                                std::memory_order_relaxed)) {
+        shrink();  // ninguém apareceu
+        return false;
+    }
+    // um pop aceitou: espera ele terminar de mover antes de liberar o nó
+    while (exchanger.state.load(std::memory_order_acquire) != DONE) {
+        std::this_thread::yield();
+    }
+    exchanger.state.store(0u, std::memory_order_relaxed);
+    this->free_node(index);
+    eliminated_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Procura uma oferta de push em uma posição e leva o elemento dela
+template<typename T>
+bool structures::EliminationStack<T>::try_eliminate_pop(T& data) {
+    Exchanger& exchanger = pick();
+    for (int i = 0; i < SPINS; i++) {
+        std::uintptr_t state = exchanger.state.load(std::memory_order_relaxed);
+        if (state == 0u) {
+            continue;
+        }
+        if ((state & 3u) != 0u) {
+            grow();  // outro pop chegou antes
+            return false;
+        }
+        if (exchanger.state.compare_exchange_strong(
+                state, state | CLAIMED, std::memory_order_acquire,
+                std::memory_order_relaxed)) {
+            data = std::move(*reinterpret_cast<Node*>(state)->data());
+            exchanger.state.store(DONE, std::memory_order_release);
+            eliminated_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    shrink();
+    return false;
+}
+
+// Escolhe uma posição aleatória dentro do trecho atual
+template<typename T>
+typename structures::EliminationStack<T>::Exchanger&
+structures::EliminationStack<T>::pick() {
+    // xorshift por thread: barato e sem estado compartilhado
+    thread_local std::uint32_t seed = static_cast<std::uint32_t>(
+        reinterpret_cast<std::uintptr_t>(&seed) >> 4) | 1u;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return exchangers_[seed % range_.load(std::memory_order_relaxed)];
+}
+
+// Aumenta o trecho usado do vetor (até SLOTS)
+template<typename T>
+void structures::EliminationStack<T>::grow() {
+    std::size_t range = range_.load(std::memory_order_relaxed);
+    if (range < SLOTS) {
+        range_.compare_exchange_weak(range, range + 1,
+                                     std::memory_order_relaxed);
+    }
+}
+
+// Diminui o trecho usado do vetor (até 1)
+template<typename T>
+void structures::EliminationStack<T>::shrink() {
+    std::size_t range = range_.load(std::memory_order_relaxed);
+    if (range > 1) {
+        range_.compare_exchange_weak(range, range - 1,
+                                     std::memory_order_relaxed);
+    }
+}
+
+#endif
@@ -0,0 +1,406 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_GAP_BUFFER_H
+#define STRUCTURES_GAP_BUFFER_H
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "./ArrayList.cpp"
+
+namespace structures {
+
+//! Lista em vetor com um buraco (gap) que acompanha o ponto de edição.
+//! Inserções e remoções perto da última edição só movem os elementos entre
+//! as duas posições; inserções repetidas no início custam O(1) amortizado.
+//! O acesso por index continua O(1). Ao contrário da ArrayList, não tem
+//! limite de tamanho nem política de limites, de propósito: sempre cresce
+//! (dobrando) quando enche, por isso não há max_size()/full(), e at, pop,
+//! remove e find sempre verificam e lançam std::out_of_range, como
+//! bounds::checked. O tamanho passado ao construtor é só a capacidade
+//! inicial.
+template<typename T>
+class GapBuffer {
+ public:
+    GapBuffer();
+    explicit GapBuffer(const std::pmr::polymorphic_allocator<T>& allocator);
+    explicit GapBuffer(std::size_t max_size,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    GapBuffer(const GapBuffer&) = delete;
+    GapBuffer& operator=(const GapBuffer&) = delete;
+    ~GapBuffer();
+
+    void clear();
+    void push_back(const T& data);
+    void push_back(T&& data);
+    void push_front(const T& data);
+    void push_front(T&& data);
+    void insert(const T& data, std::size_t index);
+    void insert(T&& data, std::size_t index);
+    template<typename... Args>
+    T& emplace(std::size_t index, Args&&... args);
+    T pop(std::size_t index);
+    T pop_back();
+    T pop_front();
+    void remove(const T& data);
+    bool empty() const;
+    bool contains(const T& data) const;
+    std::size_t find(const T& data) const;
+    std::size_t size() const;
+    std::size_t capacity() const;
+    std::pmr::memory_resource* resource() const;
+    T& at(std::size_t index);
+    T& operator[](std::size_t index);
+    const T& at(std::size_t index) const;
+    const T& operator[](std::size_t index) const;
+
+ private:
+    // [0, gap_begin_) e [gap_end_, capacity_) guardam os elementos;
+    // [gap_begin_, gap_end_) é memória bruta
+    T* contents;
+    std::size_t capacity_;
+    std::size_t gap_begin_;
+    std::size_t gap_end_;
+    std::pmr::memory_resource* resource_;
+
+    std::size_t gap_size() const;
+    void move_gap(std::size_t index);
+    void reallocate(std::size_t new_capacity);
+    T* allocate(std::size_t n);
+    void deallocate(T* p, std::size_t n);
+
+    static const auto DEFAULT_MAX = 10u;
+};
+
+}  // namespace structures
+
+// Construtor com tamanho padrão
+template<typename T>
+structures::GapBuffer<T>::GapBuffer() {
+    capacity_ = DEFAULT_MAX;
+    resource_ = std::pmr::get_default_resource();
+    contents = allocate(capacity_);
+    gap_begin_ = 0;
+    gap_end_ = capacity_;
+}
+
+// Construtor com tamanho padrão e memória vinda de 'allocator'
+template<typename T>
+structures::GapBuffer<T>::GapBuffer(
+const std::pmr::polymorphic_allocator<T>& allocator) {
+    capacity_ = DEFAULT_MAX;
+    resource_ = allocator.resource();
+    contents = allocate(capacity_);
+    gap_begin_ = 0;
+    gap_end_ = capacity_;
+}
+
+// Construtor com capacidade inicial específica
+template<typename T>
+structures::GapBuffer<T>::GapBuffer(std::size_t max_size,
+std::pmr::memory_resource* resource) {
+    capacity_ = max_size;
+    resource_ = resource;
+    contents = allocate(capacity_);
+    gap_begin_ = 0;
+    gap_end_ = capacity_;
+}
+
+// Destrutor
+template<typename T>
+structures::GapBuffer<T>::~GapBuffer() {
+    clear();
+    deallocate(contents, capacity_);
+}
+
+// Limpa a lista
+template<typename T>
+void structures::GapBuffer<T>::clear() {
+    for (std::size_t i = 0; i < gap_begin_; i++) {
+        contents[i].~T();
+    }
+    for (std::size_t i = gap_end_; i < capacity_; i++) {
+        contents[i].~T();
+    }
+    gap_begin_ = 0;
+    gap_end_ = capacity_;
+}
+
+// Adiciona um elemento no final da lista
+template<typename T>
+void structures::GapBuffer<T>::push_back(const T& data) {
+    emplace(size(), data);
+}
+
+// Adiciona um elemento no final da lista movendo o dado
+template<typename T>
+void structures::GapBuffer<T>::push_back(T&& data) {
+    emplace(size(), std::move(data));
+}
+
+// Adiciona um elemento no início da lista
+template<typename T>
+void structures::GapBuffer<T>::push_front(const T& data) {
+    emplace(0, data);
+}
+
+// Adiciona um elemento no início da lista movendo o dado
+template<typename T>
+void structures::GapBuffer<T>::push_front(T&& data) {
+    emplace(0, std::move(data));
+}
+
+// Adiciona um elemento em uma posição específica
+template<typename T>
+void structures::GapBuffer<T>::insert(const T& data, std::size_t index) {
+    emplace(index, data);
+}
+
+// Adiciona um elemento em uma posição específica movendo o dado
+template<typename T>
+void structures::GapBuffer<T>::insert(T&& data, std::size_t index) {
+    emplace(index, std::move(data));
+}
+
+// Constrói um elemento em uma posição específica
+template<typename T>
+template<typename... Args>
+T& structures::GapBuffer<T>::emplace(std::size_t index, Args&&... args) {
+    if (index > size()) {
+        throw std::out_of_range("index inválido");
+    }
+    // os argumentos podem referenciar elementos da própria lista
+    T value(std::forward<Args>(args)...);
+    if (gap_size() == 0) {
+        reallocate(capacity_ == 0 ? 1 : capacity_ * 2);
+    }
+    move_gap(index);
+    new (contents + gap_begin_) T(std::move(value));
+    gap_begin_++;
+    return contents[index];
+}
+
+// Retira um elemento de uma posição específica
+template<typename T>
+T structures::GapBuffer<T>::pop(std::size_t index) {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    if (index >= size()) {
+        throw std::out_of_range("invalid index");
+    }
+    move_gap(index);
+    T value(std::move_if_noexcept(contents[gap_end_]));
+    contents[gap_end_].~T();
+    gap_end_++;
+    return value;
+}
+
+// Retira o último elemento da lista
+template<typename T>
+T structures::GapBuffer<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    return pop(size() - 1);
+}
+
+// Retira o primeiro elemento da lista
+template<typename T>
+T structures::GapBuffer<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    return pop(0);
+}
+
+// Retira a primeira ocorrência de um elemento específico
+template<typename T>
+void structures::GapBuffer<T>::remove(const T& data) {
+    std::size_t index = find(data);
+    if (index != size()) {
+        pop(index);
+    }
+}
+
+// Testa se a lista está vazia
+template<typename T>
+bool structures::GapBuffer<T>::empty() const {
+    return size() == 0;
+}
+
+// Testa se a lista contém um dado específico
+template<typename T>
+bool structures::GapBuffer<T>::contains(const T& data) const {
+    return find(data) != size();
+}
+
+// Procura o index de um dado específico, buscando nos dois lados do buraco
+template<typename T>
+std::size_t structures::GapBuffer<T>::find(const T& data) const {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    std::size_t index = kernels::find(contents, gap_begin_, data);
+    if (index != gap_begin_) {
+        return index;
+    }
+    return gap_begin_ +
+        kernels::find(contents + gap_end_, capacity_ - gap_end_, data);
+}
+
+// Retorna o tamanho da lista
+template<typename T>
+std::size_t structures::GapBuffer<T>::size() const {
+    return capacity_ - gap_size();
+}
+
+// Retorna a capacidade atual da lista
+template<typename T>
+std::size_t structures::GapBuffer<T>::capacity() const {
+    return capacity_;
+}
+
+// Retorna a origem da memória da lista
+template<typename T>
+std::pmr::memory_resource* structures::GapBuffer<T>::resource() const {
+    return resource_;
+}
+
+// Retorna o elemento de uma posição em específico
+template<typename T>
+T& structures::GapBuffer<T>::at(std::size_t index) {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    if (index >= size()) {
+        throw std::out_of_range("invalid index");
+    }
+    return (*this)[index];
+}
+
+// Acesso aos elementos da lista pelo operador []
+template<typename T>
+T& structures::GapBuffer<T>::operator[](std::size_t index) {
+    return contents[index < gap_begin_ ? index : index + gap_size()];
+}
+
+// Retorna como constante o elemento de uma posição em específico
+template<typename T>
+const T& structures::GapBuffer<T>::at(std::size_t index) const {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    if (index >= size()) {
+        throw std::out_of_range("invalid index");
+    }
+    return (*this)[index];
+}
+
+// Acesso aos elementos como constante da lista pelo operador []
+template<typename T>
+const T& structures::GapBuffer<T>::operator[](std::size_t index) const {
+    return contents[index < gap_begin_ ? index : index + gap_size()];
+}
+
+// Tamanho do buraco
+template<typename T>
+std::size_t structures::GapBuffer<T>::gap_size() const {
+    return gap_end_ - gap_begin_;
+}
+
+// Leva o buraco para a posição 'index', movendo só os elementos entre a
+// posição atual do buraco e a nova. Fora os trivialmente copiáveis, os
+// elementos atravessam o buraco um por vez, a partir do vizinho dele: se
+// um lançar, o buraco para no meio do caminho e a lista continua íntegra.
+template<typename T>
+void structures::GapBuffer<T>::move_gap(std::size_t index) {
+    if (gap_size() == 0) {
+        gap_begin_ = index;  // sem buraco, nada muda de lugar
+        gap_end_ = index;
+        return;
+    }
+    if constexpr (!std::is_trivially_copyable<T>::value) {
+        while (index < gap_begin_) {
+            T* from = contents + gap_begin_ - 1;
+            new (contents + gap_end_ - 1) T(std::move_if_noexcept(*from));
+            from->~T();
+            gap_begin_--;
+            gap_end_--;
+        }
+        while (index > gap_begin_) {
+            T* from = contents + gap_end_;
+            new (contents + gap_begin_) T(std::move_if_noexcept(*from));
+            from->~T();
+            gap_begin_++;
+            gap_end_++;
+        }
+    } else if (index < gap_begin_) {
+        std::size_t count = gap_begin_ - index;
+        detail::relocate(contents + gap_end_ - count, contents + index, count);
+        gap_begin_ = index;
+        gap_end_ -= count;
+    } else if (index > gap_begin_) {
+        std::size_t count = index - gap_begin_;
+        detail::relocate(contents + gap_begin_, contents + gap_end_, count);
+        gap_begin_ = index;
+        gap_end_ += count;
+    }
+}
+
+// Realoca o vetor mantendo o buraco na mesma posição lógica. Se deslocar
+// T pode lançar, o vetor antigo só é desfeito depois que o novo ficou
+// completo (copiando, se mover pode lançar).
+template<typename T>
+void structures::GapBuffer<T>::reallocate(std::size_t new_capacity) {
+    std::size_t back = capacity_ - gap_end_;
+    T* new_contents = allocate(new_capacity);
+    if constexpr (detail::nothrow_relocatable<T>::value) {
+        detail::relocate(new_contents, contents, gap_begin_);
+        detail::relocate(new_contents + new_capacity - back,
+                         contents + gap_end_, back);
+    } else {
+        bool front = false;
+        try {
+            detail::construct_if_noexcept(new_contents, contents, gap_begin_);
+            front = true;
+            detail::construct_if_noexcept(new_contents + new_capacity - back,
+                                          contents + gap_end_, back);
+        } catch (...) {
+            if (front) {
+                std::destroy(new_contents, new_contents + gap_begin_);
+            }
+            deallocate(new_contents, new_capacity);
+            throw;
+        }
+        std::destroy(contents, contents + gap_begin_);
+        std::destroy(contents + gap_end_, contents + capacity_);
+    }
+    deallocate(contents, capacity_);
+    contents = new_contents;
+    capacity_ = new_capacity;
+    gap_end_ = new_capacity - back;
+}
+
+// Aloca memória bruta de 'resource_', sem construir elementos (lança
+// std::bad_array_new_length se n * sizeof(T) não couber em um size_t)
+template<typename T>
+T* structures::GapBuffer<T>::allocate(std::size_t n) {
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+        throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+}
+
+// Libera a memória alocada por 'allocate'
+template<typename T>
+void structures::GapBuffer<T>::deallocate(T* p, std::size_t n) {
+    resource_->deallocate(p, n * sizeof(T), alignof(T));
+}
+
+#endif
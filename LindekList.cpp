@@ -3,11 +3,19 @@
 #define STRUCTURES_LINKED_LIST_H
 
 #include <cstdint>
+#include <istream>
+#include <memory_resource>
+#include <new>
+#include <ostream>
+#include <stdexcept>
 
+#include "./BoundsPolicy.cpp"
+#include "./Serialization.cpp"
 
 namespace structures {
-//! ...
-template<typename T>
+//! Bounds: verificação de limites (bounds::checked, debug_assert ou
+//! unchecked, em BoundsPolicy.cpp)
+template<typename T, typename Bounds = bounds::checked>
 class LinkedList {
  private:
     class Node {  // Elemento
@@ -50,6 +58,9 @@ class LinkedList {
     //! ...
     LinkedList();  // construtor padrão
     //! ...
+    explicit LinkedList(
+        const std::pmr::polymorphic_allocator<T>& allocator);  // com memória
+    //! ...
     ~LinkedList();  // destrutor
     //! ...
     void clear();  // limpar lista
@@ -83,6 +94,12 @@ class LinkedList {
     std::size_t find(const T& data) const;  // posição do dado
     //! ...
     std::size_t size() const;  // tamanho da lista
+    //! ...
+    std::pmr::memory_resource* resource() const;  // origem da memória
+    //! ...
+    void save(std::ostream& out) const;  // gravar (Serialization.cpp)
+    //! ...
+    void load(std::istream& in);  // substituir pelo conteúdo lido
 
     Node* end() {  // último nodo da lista
         auto it = head;
@@ -95,34 +112,47 @@ class LinkedList {
     Node* head{nullptr};
     Node* tail{nullptr};
     std::size_t size_{0u};
+
+ private:
+    Node* create_node(const T& data);  // aloca um nodo em 'resource_'
+    void destroy_node(Node* node);  // devolve um nodo para 'resource_'
+
+    std::pmr::memory_resource* resource_{std::pmr::get_default_resource()};
 };
 
 }  // namespace structures
 
 // Construtor
-template<typename T>
-structures::LinkedList<T>::LinkedList() {
+template<typename T, typename Bounds>
+structures::LinkedList<T, Bounds>::LinkedList() {
 }
 
+// Construtor com os nodos vindos de 'allocator'
+template<typename T, typename Bounds>
+structures::LinkedList<T, Bounds>::LinkedList(
+const std::pmr::polymorphic_allocator<T>& allocator):
+    resource_{allocator.resource()}
+{}
+
 // Destrutor
-template<typename T>
-structures::LinkedList<T>::~LinkedList() {
+template<typename T, typename Bounds>
+structures::LinkedList<T, Bounds>::~LinkedList() {
     clear();
 }
 
 // Limpa a lista
-template<typename T>
-void structures::LinkedList<T>::clear() {
+template<typename T, typename Bounds>
+void structures::LinkedList<T, Bounds>::clear() {
     while (!empty()) {
         pop_front();
     }
 }
 
 // Insere um dado no fim da lista
-template<typename T>
-void structures::LinkedList<T>::push_back(const T& data) {
+template<typename T, typename Bounds>
+void structures::LinkedList<T, Bounds>::push_back(const T& data) {
     Node* novo;
-    novo = new Node(data);
+    novo = create_node(data);
     if (novo == nullptr) {
         throw std::out_of_range("no memory available");
     }
@@ -137,10 +167,10 @@ void structures::LinkedList<T>::push_back(const T& data) {
 }
 
 // Insere um dado no início da lista
-template<typename T>
-void structures::LinkedList<T>::push_front(const T& data) {
+template<typename T, typename Bounds>
+void structures::LinkedList<T, Bounds>::push_front(const T& data) {
     Node* novo;
-    novo = new Node(data);
+    novo = create_node(data);
     if (novo == nullptr) {
         throw std::out_of_range("no memory available");
     }
@@ -155,18 +185,17 @@ void structures::LinkedList<T>::push_front(const T& data) {
 }
 
 // Insere um dado em uma posição específica da lista
-template<typename T>
-void structures::LinkedList<T>::insert(const T& data, std::size_t index) {
-    if (index > size()) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+void structures::LinkedList<T, Bounds>::insert(const T& data,
+std::size_t index) {
+    Bounds::require(index <= size(), "invalid index");
     if (index == 0) {
         push_front(data);
     } else if (index == size_) {
         push_back(data);
     } else {
         Node* novo;
-        novo = new Node(data);
+        novo = create_node(data);
         if (novo == nullptr) {
             throw std::out_of_range("no memory available");
         }
@@ -178,8 +207,8 @@ void structures::LinkedList<T>::insert(const T& data, std::size_t index) {
 }
 
 // Insere um dado na lista de forma ordenada
-template<typename T>
-void structures::LinkedList<T>::insert_sorted(const T& data) {
+template<typename T, typename Bounds>
+void structures::LinkedList<T, Bounds>::insert_sorted(const T& data) {
     Node* current_node = head;
     std::size_t index = size_;
     for (std::size_t i = 0; i < size_; i++) {
@@ -194,11 +223,9 @@ void structures::LinkedList<T>::insert_sorted(const T& data) {
 }
 
 // Acessa o dado de uma posição específica
-template<typename T>
-T& structures::LinkedList<T>::at(std::size_t index) {
-    if (empty() || index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+T& structures::LinkedList<T, Bounds>::at(std::size_t index) {
+    Bounds::require(!empty() && index < size_, "invalid index");
     Node* current_node = head;
     for (std::size_t i = 0; i < index; i++) {
         current_node = current_node->next();
@@ -207,12 +234,10 @@ T& structures::LinkedList<T>::at(std::size_t index) {
 }
 
 // Acessa o ponteiro para uma posição específica
-template<typename T>
-typename structures::LinkedList<T>::Node*
-structures::LinkedList<T>::at_pointer(std::size_t index) {
-    if (empty() || index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+typename structures::LinkedList<T, Bounds>::Node*
+structures::LinkedList<T, Bounds>::at_pointer(std::size_t index) {
+    Bounds::require(!empty() && index < size_, "invalid index");
     Node* current_node = head;
     for (std::size_t i = 0; i < index; i++) {
         current_node = current_node->next();
@@ -221,14 +246,10 @@ structures::LinkedList<T>::at_pointer(std::size_t index) {
 }
 
 // Retira um elemento de uma posição específica
-template<typename T>
-T structures::LinkedList<T>::pop(std::size_t index) {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
-    if (index >= size_) {
-        throw std::out_of_range("invalid index");
-    }
+template<typename T, typename Bounds>
+T structures::LinkedList<T, Bounds>::pop(std::size_t index) {
+    Bounds::require(!empty(), "the list is empty");
+    Bounds::require(index < size_, "invalid index");
     T data;
     if (index == 0) {
         data = pop_front();
@@ -239,43 +260,39 @@ T structures::LinkedList<T>::pop(std::size_t index) {
         Node* current = prev->next();
         data = current->data();
         prev->next(current->next());
-        delete current;
+        destroy_node(current);
         size_--;
     }
     return data;
 }
 
 // Retira o último elemento da lista
-template<typename T>
-T structures::LinkedList<T>::pop_back() {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+T structures::LinkedList<T, Bounds>::pop_back() {
+    Bounds::require(!empty(), "the list is empty");
     T data;
     if (size_ == 1) {
         Node* current = tail;
         head = nullptr;
         tail = nullptr;
         data = current->data();
-        delete current;
+        destroy_node(current);
     } else {
         Node* prev = at_pointer(size_-2);
         Node* current = prev->next();
         prev->next(nullptr);
         tail = prev;
         data = current->data();
-        delete current;
+        destroy_node(current);
     }
     size_--;
     return data;
 }
 
 // Retira o primeiro elemento da lista
-template<typename T>
-T structures::LinkedList<T>::pop_front() {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+T structures::LinkedList<T, Bounds>::pop_front() {
+    Bounds::require(!empty(), "the list is empty");
     Node* old_head = head;
     if (size_ == 1) {
         head = nullptr;
@@ -284,21 +301,17 @@ T structures::LinkedList<T>::pop_front() {
         head = old_head->next();
     }
     T data = old_head->data();
-    delete old_head;
+    destroy_node(old_head);
     size_--;
     return data;
 }
 
 // Retira um elemento dado o ponteiro do elemento anterior
-template<typename T>
-T structures::LinkedList<T>::pop_pointer(Node* prev) {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+T structures::LinkedList<T, Bounds>::pop_pointer(Node* prev) {
+    Bounds::require(!empty(), "the list is empty");
     Node* current = prev->next();
-    if (current == nullptr) {
-        throw std::out_of_range("pointer is nullptr");
-    }
+    Bounds::require(current != nullptr, "pointer is nullptr");
     T data;
     if (current == head) {
         data = pop_front();
@@ -307,18 +320,16 @@ T structures::LinkedList<T>::pop_pointer(Node* prev) {
     } else {
         prev->next(current->next());
         data = current->data();
-        delete current;
+        destroy_node(current);
         size_--;
     }
     return data;
 }
 
 // Remove um valor específico da lista na sua primeira aparição
-template<typename T>
-void structures::LinkedList<T>::remove(const T& data) {
-    if (empty()) {
-        throw std::out_of_range("the list is empty");
-    }
+template<typename T, typename Bounds>
+void structures::LinkedList<T, Bounds>::remove(const T& data) {
+    Bounds::require(!empty(), "the list is empty");
     Node* current = head;
     Node* prev = nullptr;
     for (std::size_t i = 0; i < size_; i++) {
@@ -333,8 +344,8 @@ void structures::LinkedList<T>::remove(const T& data) {
 }
 
 // Verifica se a lista está vazia
-template<typename T>
-bool structures::LinkedList<T>::empty() const {
+template<typename T, typename Bounds>
+bool structures::LinkedList<T, Bounds>::empty() const {
     if (size_ == 0) {
         return true;
     } else {
@@ -343,8 +354,8 @@ bool structures::LinkedList<T>::empty() const {
 }
 
 // Verifica se a lista contém um dado
-template<typename T>
-bool structures::LinkedList<T>::contains(const T& data) const {
+template<typename T, typename Bounds>
+bool structures::LinkedList<T, Bounds>::contains(const T& data) const {
     Node* current = head;
     bool contain = false;
     while (current != nullptr) {
@@ -358,8 +369,8 @@ bool structures::LinkedList<T>::contains(const T& data) const {
 }
 
 // Verifica o index da primeira aparição de um dado
-template<typename T>
-std::size_t structures::LinkedList<T>::find(const T& data) const {
+template<typename T, typename Bounds>
+std::size_t structures::LinkedList<T, Bounds>::find(const T& data) const {
     Node* current = head;
     std::size_t index = 0;
     while (current != nullptr) {
@@ -373,9 +384,55 @@ std::size_t structures::LinkedList<T>::find(const T& data) const {
 }
 
 // Verifica o tamanho da lista
-template<typename T>
-std::size_t structures::LinkedList<T>::size() const {
+template<typename T, typename Bounds>
+std::size_t structures::LinkedList<T, Bounds>::size() const {
     return size_;
 }
 
+// Retorna a origem da memória dos nodos
+template<typename T, typename Bounds>
+std::pmr::memory_resource* structures::LinkedList<T, Bounds>::resource() const {
+    return resource_;
+}
+
+// Grava a lista em 'out', percorrendo os nodos uma única vez
+template<typename T, typename Bounds>
+void structures::LinkedList<T, Bounds>::save(std::ostream& out) const {
+    serialization::write_header<T>(out, size_);
+    for (const Node* current = head; current != nullptr;
+         current = current->next()) {
+        serialization::write_element(out, current->data());
+    }
+}
+
+// Substitui o conteúdo da lista pela sequência lida de 'in'
+template<typename T, typename Bounds>
+void structures::LinkedList<T, Bounds>::load(std::istream& in) {
+    std::uint64_t count = serialization::read_header<T>(in);
+    clear();
+    for (std::uint64_t i = 0; i < count; i++) {
+        push_back(serialization::read_element<T>(in));
+    }
+}
+
+// Aloca e constrói um nodo em 'resource_'
+template<typename T, typename Bounds>
+typename structures::LinkedList<T, Bounds>::Node*
+structures::LinkedList<T, Bounds>::create_node(const T& data) {
+    void* raw = resource_->allocate(sizeof(Node), alignof(Node));
+    try {
+        return new (raw) Node(data);
+    } catch (...) {
+        resource_->deallocate(raw, sizeof(Node), alignof(Node));
+        throw;
+    }
+}
+
+// Destrói um nodo e devolve sua memória para 'resource_'
+template<typename T, typename Bounds>
+void structures::LinkedList<T, Bounds>::destroy_node(Node* node) {
+    node->~Node();
+    resource_->deallocate(node, sizeof(Node), alignof(Node));
+}
+
 #endif
@@ -0,0 +1,474 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_MAPPED_ARRAY_LIST_H
+#define STRUCTURES_MAPPED_ARRAY_LIST_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include "./ArrayList.cpp"
+
+namespace structures {
+
+//! ArrayList guardada em um arquivo mapeado com mmap (POSIX). O tamanho e a
+//! capacidade ficam num cabeçalho no início do arquivo, então reabrir a
+//! lista só mapeia o arquivo, sem carregar os elementos. Vários processos
+//! podem mapear o mesmo arquivo e compartilhar as páginas, mas a lista não
+//! sincroniza escritas concorrentes e só um processo pode escrever: o
+//! mapeamento dos outros não acompanha o arquivo quando ele cresce ou
+//! encolhe (insert, reserve, shrink_to_fit), então eles precisam reabrir a
+//! lista depois disso.
+template<typename T>
+class MappedArrayList {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "MappedArrayList só guarda tipos trivialmente copiáveis");
+    static_assert(alignof(T) <= 64, "alinhamento maior que o cabeçalho");
+
+ public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    // abre o arquivo, ou o cria com capacidade 'max_size'
+    explicit MappedArrayList(const std::string& path,
+                             std::size_t max_size = DEFAULT_MAX);
+    MappedArrayList(const MappedArrayList&) = delete;
+    MappedArrayList& operator=(const MappedArrayList&) = delete;
+    ~MappedArrayList();
+
+    void clear();
+    void push_back(const T& data);
+    void push_front(const T& data);
+    void insert(const T& data, std::size_t index);
+    T pop(std::size_t index);
+    T pop_back();
+    T pop_front();
+    void remove(const T& data);
+    bool full() const;
+    bool empty() const;
+    bool contains(const T& data) const;
+    std::size_t find(const T& data) const;
+    std::size_t size() const;
+    std::size_t max_size() const;
+    std::size_t capacity() const;
+    void reserve(std::size_t new_capacity);
+    void shrink_to_fit();
+    void sync();  // grava as páginas alteradas no arquivo (msync)
+    T& at(std::size_t index);
+    T& operator[](std::size_t index);
+    const T& at(std::size_t index) const;
+    const T& operator[](std::size_t index) const;
+    T* data();
+    const T* data() const;
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+ private:
+    // Cabeçalho no início do arquivo; os elementos começam no byte 64
+    struct Header {
+        std::uint64_t magic;
+        std::uint32_t version;
+        std::uint32_t element_size;
+        std::uint64_t size;
+        std::uint64_t max_size;
+    };
+
+    int fd_;
+    void* map_;
+    std::size_t map_length_;
+    Header* header;
+    T* contents;
+
+    void map(std::size_t new_capacity);
+    void unmap();
+    void expand(std::size_t min_capacity);
+
+    static std::size_t max_capacity();
+    static std::size_t file_length(std::size_t capacity);
+    [[noreturn]] static void fail(const char* what);
+
+    static const std::size_t DATA_OFFSET = 64u;
+    static const std::uint64_t MAGIC = 0x4c41504d52545353ull;  // "SSTRMPAL"
+    static const std::uint32_t VERSION = 1u;
+    static const auto DEFAULT_MAX = 10u;
+};
+
+}  // namespace structures
+
+// Abre (ou cria) o arquivo e mapeia a lista
+template<typename T>
+structures::MappedArrayList<T>::MappedArrayList(const std::string& path,
+std::size_t max_size) {
+    map_ = nullptr;
+    map_length_ = 0;
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        fail("open");
+    }
+    try {
+        struct stat info;
+        if (::fstat(fd_, &info) != 0) {
+            fail("fstat");
+        }
+        if (info.st_size == 0) {
+            // arquivo novo: cria o cabeçalho
+            map(max_size);
+            header->magic = MAGIC;
+            header->version = VERSION;
+            header->element_size = sizeof(T);
+            header->size = 0;
+            return;
+        }
+        Header stored;
+        if (static_cast<std::size_t>(info.st_size) < DATA_OFFSET ||
+            ::pread(fd_, &stored, sizeof(Header), 0) !=
+                static_cast<ssize_t>(sizeof(Header)) ||
+            stored.magic != MAGIC || stored.version != VERSION ||
+            stored.element_size != sizeof(T) ||
+            stored.max_size > max_capacity() ||
+            stored.size > stored.max_size ||
+            static_cast<std::size_t>(info.st_size) <
+                file_length(stored.max_size)) {
+            throw std::runtime_error(
+                "arquivo não é uma MappedArrayList deste T");
+        }
+        map(stored.max_size);
+    } catch (...) {
+        unmap();
+        ::close(fd_);
+        throw;
+    }
+}
+
+// Destrutor: desfaz o mapeamento (o conteúdo continua no arquivo)
+template<typename T>
+structures::MappedArrayList<T>::~MappedArrayList() {
+    unmap();
+    ::close(fd_);
+}
+
+// Limpa a lista
+template<typename T>
+void structures::MappedArrayList<T>::clear() {
+    header->size = 0;
+}
+
+// Adiciona um elemento no final da lista
+template<typename T>
+void structures::MappedArrayList<T>::push_back(const T& data) {
+    insert(data, size());
+}
+
+// Adiciona um elemento no início da lista
+template<typename T>
+void structures::MappedArrayList<T>::push_front(const T& data) {
+    insert(data, 0);
+}
+
+// Adiciona um elemento em uma posição específica
+template<typename T>
+void structures::MappedArrayList<T>::insert(const T& data,
+std::size_t index) {
+    if (index > size()) {
+        throw std::out_of_range("index inválido");
+    }
+    T value = data;  // 'data' pode estar no mapeamento que será refeito
+    if (full()) {
+        expand(size() + 1);
+    }
+    detail::relocate(contents + index + 1, contents + index, size() - index);
+    contents[index] = value;
+    header->size++;
+}
+
+// Retira um elemento de uma posição específica
+template<typename T>
+T structures::MappedArrayList<T>::pop(std::size_t index) {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    if (index >= size()) {
+        throw std::out_of_range("invalid index");
+    }
+    T value = contents[index];
+    detail::relocate(contents + index, contents + index + 1,
+                     size() - index - 1);
+    header->size--;
+    return value;
+}
+
+// Retira o último elemento da lista
+template<typename T>
+T structures::MappedArrayList<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    header->size--;
+    return contents[header->size];
+}
+
+// Retira o primeiro elemento da lista
+template<typename T>
+T structures::MappedArrayList<T>::pop_front() {
+    return pop(0);
+}
+
+// Retira a primeira ocorrência de um elemento específico
+template<typename T>
+void structures::MappedArrayList<T>::remove(const T& data) {
+    std::size_t index = find(data);
+    if (index != size()) {
+        pop(index);
+    }
+}
+
+// Testa se a capacidade atual está toda ocupada
+template<typename T>
+bool structures::MappedArrayList<T>::full() const {
+    return size() == max_size();
+}
+
+// Testa se a lista está vazia
+template<typename T>
+bool structures::MappedArrayList<T>::empty() const {
+    return size() == 0;
+}
+
+// Testa se a lista contém um dado específico
+template<typename T>
+bool structures::MappedArrayList<T>::contains(const T& data) const {
+    return find(data) != size();
+}
+
+// Procura o index de um dado específico
+template<typename T>
+std::size_t structures::MappedArrayList<T>::find(const T& data) const {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    return kernels::find(contents, size(), data);
+}
+
+// Retorna o tamanho da lista
+template<typename T>
+std::size_t structures::MappedArrayList<T>::size() const {
+    return static_cast<std::size_t>(header->size);
+}
+
+// Retorna o tamanho máximo (capacidade) da lista
+template<typename T>
+std::size_t structures::MappedArrayList<T>::max_size() const {
+    return static_cast<std::size_t>(header->max_size);
+}
+
+// Retorna a capacidade atual da lista
+template<typename T>
+std::size_t structures::MappedArrayList<T>::capacity() const {
+    return max_size();
+}
+
+// Garante capacidade para pelo menos 'new_capacity' elementos
+template<typename T>
+void structures::MappedArrayList<T>::reserve(std::size_t new_capacity) {
+    if (new_capacity > max_size()) {
+        map(new_capacity);
+    }
+}
+
+// Reduz o arquivo ao número de elementos da lista
+template<typename T>
+void structures::MappedArrayList<T>::shrink_to_fit() {
+    if (size() < max_size()) {
+        map(size());
+    }
+}
+
+// Grava as páginas alteradas (e o cabeçalho) no arquivo
+template<typename T>
+void structures::MappedArrayList<T>::sync() {
+    if (::msync(map_, map_length_, MS_SYNC) != 0) {
+        fail("msync");
+    }
+}
+
+// Retorna o elemento de uma posição em específico
+template<typename T>
+T& structures::MappedArrayList<T>::at(std::size_t index) {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    if (index >= size()) {
+        throw std::out_of_range("invalid index");
+    }
+    return contents[index];
+}
+
+// Acesso aos elementos da lista pelo operador []
+template<typename T>
+T& structures::MappedArrayList<T>::operator[](std::size_t index) {
+    return contents[index];
+}
+
+// Retorna como constante o elemento de uma posição em específico
+template<typename T>
+const T& structures::MappedArrayList<T>::at(std::size_t index) const {
+    if (empty()) {
+        throw std::out_of_range("empty list");
+    }
+    if (index >= size()) {
+        throw std::out_of_range("invalid index");
+    }
+    return contents[index];
+}
+
+// Acesso aos elementos como constante da lista pelo operador []
+template<typename T>
+const T& structures::MappedArrayList<T>::operator[](
+std::size_t index) const {
+    return contents[index];
+}
+
+// Ponteiro para o primeiro elemento
+template<typename T>
+T* structures::MappedArrayList<T>::data() {
+    return contents;
+}
+
+// Ponteiro constante para o primeiro elemento
+template<typename T>
+const T* structures::MappedArrayList<T>::data() const {
+    return contents;
+}
+
+// Iterador para o início da lista
+template<typename T>
+typename structures::MappedArrayList<T>::iterator
+structures::MappedArrayList<T>::begin() {
+    return contents;
+}
+
+// Iterador para depois do último elemento da lista
+template<typename T>
+typename structures::MappedArrayList<T>::iterator
+structures::MappedArrayList<T>::end() {
+    return contents + size();
+}
+
+// Iterador constante para o início da lista
+template<typename T>
+typename structures::MappedArrayList<T>::const_iterator
+structures::MappedArrayList<T>::begin() const {
+    return contents;
+}
+
+// Iterador constante para depois do último elemento da lista
+template<typename T>
+typename structures::MappedArrayList<T>::const_iterator
+structures::MappedArrayList<T>::end() const {
+    return contents + size();
+}
+
+// Ajusta o arquivo para 'new_capacity' elementos e (re)mapeia. O arquivo
+// nunca fica menor que o mapeamento em uso (acessar além do fim dá
+// SIGBUS): ao crescer, estende antes de mapear e volta ao tamanho antigo
+// se o mmap falhar; ao encolher, só trunca depois de trocar o mapeamento.
+template<typename T>
+void structures::MappedArrayList<T>::map(std::size_t new_capacity) {
+    std::size_t length = file_length(new_capacity);
+    std::size_t old_length = map_length_;
+    if (map_ == nullptr) {
+        struct stat info;
+        if (::fstat(fd_, &info) != 0) {
+            fail("fstat");
+        }
+        old_length = static_cast<std::size_t>(info.st_size);
+    }
+    bool growing = length > old_length;
+    if (growing && ::ftruncate(fd_, static_cast<off_t>(length)) != 0) {
+        fail("ftruncate");
+    }
+    // o mapeamento antigo só é desfeito depois que o novo deu certo
+    void* address = ::mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                           MAP_SHARED, fd_, 0);
+    if (address == MAP_FAILED) {
+        int error = errno;
+        if (growing && ::ftruncate(fd_, static_cast<off_t>(old_length)) != 0) {
+            // sem como desfazer: o arquivo fica maior, mas íntegro
+        }
+        errno = error;
+        fail("mmap");
+    }
+    unmap();
+    map_ = address;
+    map_length_ = length;
+    header = static_cast<Header*>(address);
+    contents = reinterpret_cast<T*>(static_cast<char*>(address) +
+                                    DATA_OFFSET);
+    header->max_size = new_capacity;
+    if (!growing && length < old_length &&
+        ::ftruncate(fd_, static_cast<off_t>(length)) != 0) {
+        fail("ftruncate");  // o arquivo só ficou maior que o necessário
+    }
+}
+
+// Desfaz o mapeamento atual, se houver
+template<typename T>
+void structures::MappedArrayList<T>::unmap() {
+    if (map_ != nullptr) {
+        ::munmap(map_, map_length_);
+        map_ = nullptr;
+    }
+}
+
+// Dobra a capacidade (sem passar do limite) até caber 'min_capacity'
+// elementos
+template<typename T>
+void structures::MappedArrayList<T>::expand(std::size_t min_capacity) {
+    std::size_t new_capacity = max_size() > max_capacity() / 2 ?
+        max_capacity() : max_size() * 2;
+    if (new_capacity < min_capacity) {
+        new_capacity = min_capacity;
+    }
+    map(new_capacity);
+}
+
+// Maior capacidade cujo tamanho de arquivo cabe em size_t e em off_t
+template<typename T>
+std::size_t structures::MappedArrayList<T>::max_capacity() {
+    std::uintmax_t limit = std::numeric_limits<std::size_t>::max();
+    std::uintmax_t offsets = std::numeric_limits<off_t>::max();
+    if (offsets < limit) {
+        limit = offsets;
+    }
+    return static_cast<std::size_t>((limit - DATA_OFFSET) / sizeof(T));
+}
+
+// Tamanho do arquivo para uma capacidade
+template<typename T>
+std::size_t structures::MappedArrayList<T>::file_length(
+std::size_t capacity) {
+    if (capacity > max_capacity()) {
+        throw std::bad_array_new_length();
+    }
+    return DATA_OFFSET + capacity * sizeof(T);
+}
+
+// Lança o erro da última chamada de sistema
+template<typename T>
+void structures::MappedArrayList<T>::fail(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+#endif
@@ -0,0 +1,238 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_MPMC_QUEUE_H
+#define STRUCTURES_MPMC_QUEUE_H
+
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::size_t, std::intptr_t
+#include <limits>  // std::numeric_limits
+#include <memory_resource>  // std::pmr::memory_resource
+#include <new>  // placement new, std::bad_array_new_length
+#include <type_traits>  // std::is_nothrow_move_constructible
+#include <utility>  // std::move
+
+#include "./SpscQueue.cpp"  // CACHE_LINE
+
+namespace structures {
+
+template<typename T>
+//! Fila circular limitada sem travas para vários produtores e vários
+//! consumidores (algoritmo de Dmitry Vyukov). Cada posição do vetor tem um
+//! número de sequência que diz de quem é a vez de usá-la, então produtores
+//! e consumidores só disputam o seu próprio índice. A capacidade é
+//! arredondada para uma potência de dois.
+class MpmcQueue {
+    static_assert(std::is_nothrow_move_constructible<T>::value &&
+                  std::is_nothrow_move_assignable<T>::value,
+                  "uma posição reservada não pode ficar sem elemento");
+
+ public:
+    //! construtor padrao
+    MpmcQueue();
+    //! construtor com origem da memoria
+    explicit MpmcQueue(const std::pmr::polymorphic_allocator<T>& allocator);
+    //! construtor com parametro (arredondado para potencia de dois)
+    explicit MpmcQueue(std::size_t max,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+    //! destrutor padrao
+    ~MpmcQueue();
+    //! enfileira uma copia; false se a fila estiver cheia
+    bool try_enqueue(const T& data);
+    //! enfileira movendo o dado; false (e 'data' intacto) se cheia
+    bool try_enqueue(T&& data);
+    //! move o inicio da fila para 'data'; false se vazia
+    bool try_dequeue(T& data);
+    //! tamanho aproximado (exato se nenhuma thread estiver mexendo)
+    std::size_t size() const;
+    //! tamanho maximo
+    std::size_t max_size() const;
+    //! fila vazia (aproximado)
+    bool empty() const;
+    //! origem da memoria
+    std::pmr::memory_resource* resource() const;
+
+ private:
+    // A posição i está livre para o produtor da volta 'pos' quando
+    // sequence == pos, e cheia para o consumidor quando sequence == pos + 1
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* data() {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    Slot* claim_enqueue();
+    Slot* claim_dequeue(std::size_t& pos);
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_{0u};  // consumidores
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0u};  // produtores
+
+    // só lidos depois da construção
+    alignas(CACHE_LINE) Slot* slots;
+    std::size_t mask_;  // capacidade - 1
+    std::pmr::memory_resource* resource_;
+
+    static const auto DEFAULT_SIZE = 16u;
+};
+
+}  // namespace structures
+
+// Construtor com tamanho padrão
+template<typename T>
+structures::MpmcQueue<T>::MpmcQueue():
+    MpmcQueue(DEFAULT_SIZE)
+{}
+
+// Construtor com tamanho padrão e memória vinda de 'allocator'
+template<typename T>
+structures::MpmcQueue<T>::MpmcQueue(
+const std::pmr::polymorphic_allocator<T>& allocator):
+    MpmcQueue(DEFAULT_SIZE, allocator.resource())
+{}
+
+// Construtor com tamanho específico, arredondado para potência de dois
+// (lança std::bad_array_new_length se a potência de dois em bytes não
+// couber em um size_t)
+template<typename T>
+structures::MpmcQueue<T>::MpmcQueue(std::size_t max,
+std::pmr::memory_resource* resource) {
+    if (max > std::numeric_limits<std::size_t>::max() / 2 / sizeof(Slot)) {
+        throw std::bad_array_new_length();
+    }
+    std::size_t capacity = 2;
+    while (capacity < max) {
+        capacity *= 2;
+    }
+    mask_ = capacity - 1;
+    resource_ = resource;
+    slots = static_cast<Slot*>(
+        resource_->allocate(capacity * sizeof(Slot), alignof(Slot)));
+    for (std::size_t i = 0; i < capacity; i++) {
+        new (&slots[i].sequence) std::atomic<std::size_t>(i);
+    }
+}
+
+// Destrutor: destrói o que ficou na fila
+template<typename T>
+structures::MpmcQueue<T>::~MpmcQueue() {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    for (std::size_t pos = head_.load(std::memory_order_relaxed);
+         pos != tail; pos++) {
+        slots[pos & mask_].data()->~T();
+    }
+    resource_->deallocate(slots, (mask_ + 1) * sizeof(Slot), alignof(Slot));
+}
+
+// Enfileira uma cópia do dado (copiado antes de reservar a posição, para
+// que uma exceção na cópia não deixe a posição vazia)
+template<typename T>
+bool structures::MpmcQueue<T>::try_enqueue(const T& data) {
+    T copy(data);
+    return try_enqueue(std::move(copy));
+}
+
+// Enfileira movendo o dado
+template<typename T>
+bool structures::MpmcQueue<T>::try_enqueue(T&& data) {
+    Slot* slot = claim_enqueue();
+    if (slot == nullptr) {
+        return false;
+    }
+    std::size_t pos = slot->sequence.load(std::memory_order_relaxed);
+    new (slot->data()) T(std::move(data));
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+// Retira o elemento do início da fila
+template<typename T>
+bool structures::MpmcQueue<T>::try_dequeue(T& data) {
+    std::size_t pos;
+    Slot* slot = claim_dequeue(pos);
+    if (slot == nullptr) {
+        return false;
+    }
+    data = std::move(*slot->data());
+    slot->data()->~T();
+    // libera a posição para o produtor da próxima volta
+    slot->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+}
+
+// Consulta o tamanho da fila
+template<typename T>
+std::size_t structures::MpmcQueue<T>::size() const {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+}
+
+// Consulta o tamanho máximo da fila
+template<typename T>
+std::size_t structures::MpmcQueue<T>::max_size() const {
+    return mask_ + 1;
+}
+
+// Verifica se a fila está vazia
+template<typename T>
+bool structures::MpmcQueue<T>::empty() const {
+    return size() == 0;
+}
+
+// Consulta a origem da memória da fila
+template<typename T>
+std::pmr::memory_resource* structures::MpmcQueue<T>::resource() const {
+    return resource_;
+}
+
+// Reserva a posição do fim da fila para um produtor, ou nullptr se cheia
+template<typename T>
+typename structures::MpmcQueue<T>::Slot*
+structures::MpmcQueue<T>::claim_enqueue() {
+    std::size_t pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot* slot = &slots[pos & mask_];
+        std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) -
+                             static_cast<std::intptr_t>(pos);
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed)) {
+                return slot;
+            }
+        } else if (diff < 0) {
+            return nullptr;  // o consumidor da volta anterior não passou
+        } else {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// Reserva a posição do início da fila para um consumidor, ou nullptr se
+// vazia; 'pos' recebe a posição lógica reservada
+template<typename T>
+typename structures::MpmcQueue<T>::Slot*
+structures::MpmcQueue<T>::claim_dequeue(std::size_t& pos) {
+    pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot* slot = &slots[pos & mask_];
+        std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) -
+                             static_cast<std::intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (head_.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed)) {
+                return slot;
+            }
+        } else if (diff < 0) {
+            return nullptr;  // o produtor desta volta ainda não escreveu
+        } else {
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,267 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_SEGMENTED_STACK_H
+#define STRUCTURES_SEGMENTED_STACK_H
+
+#include <cstdint>  // std::size_t
+#include <memory_resource>  // std::pmr::memory_resource
+#include <new>  // placement new
+#include <stdexcept>  // C++ exceptions
+#include <utility>  // std::move, std::forward
+
+namespace structures {
+
+template<typename T>
+//! Pilha sem limite de tamanho guardada em blocos (chunks) encadeados de
+//! tamanho fixo. Crescer só aloca um bloco novo, então nenhum elemento
+//! muda de lugar e as referências de top() continuam válidas até o
+//! elemento ser desempilhado. Um bloco vazio fica guardado como reserva,
+//! para um push/pop alternando na fronteira entre blocos não alocar e
+//! liberar a cada operação.
+class SegmentedStack {
+ public:
+    //! construtor simples
+    SegmentedStack();
+    //! construtor com origem da memoria
+    explicit SegmentedStack(
+        const std::pmr::polymorphic_allocator<T>& allocator);
+    //! construtor com o numero de elementos por bloco
+    explicit SegmentedStack(std::size_t chunk_size,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    SegmentedStack(const SegmentedStack&) = delete;
+    SegmentedStack& operator=(const SegmentedStack&) = delete;
+    //! destrutor
+    ~SegmentedStack();
+    //! metodo empilha uma copia
+    void push(const T& data);
+    //! metodo empilha movendo o dado
+    void push(T&& data);
+    //! metodo constroi o elemento no topo
+    template<typename... Args>
+    T& emplace(Args&&... args);
+    //! metodo desempilha
+    T pop();
+    //! metodo retorna o topo
+    T& top();
+    //! metodo limpa pilha (libera os blocos)
+    void clear();
+    //! metodo retorna tamanho
+    std::size_t size() const;
+    //! verifica se esta vazia
+    bool empty() const;
+    //! retorna o numero de elementos por bloco
+    std::size_t chunk_size() const;
+    //! retorna a origem da memoria
+    std::pmr::memory_resource* resource() const;
+
+ private:
+    // Cabeçalho de um bloco; os elementos vêm logo depois dele
+    struct Chunk {
+        Chunk* prev;
+    };
+
+    Chunk* allocate_chunk();
+    void deallocate_chunk(Chunk* chunk);
+    T* elements(Chunk* chunk) const;
+    std::size_t chunk_bytes() const;
+
+    Chunk* top_chunk_{nullptr};
+    Chunk* spare_{nullptr};  // bloco vazio guardado para o próximo push
+    std::size_t top_count_{0u};  // elementos em top_chunk_
+    std::size_t size_{0u};
+    std::size_t chunk_size_;
+    std::pmr::memory_resource* resource_;
+
+    // os elementos começam no primeiro múltiplo de alignof(T) depois do
+    // cabeçalho
+    static const std::size_t HEADER_SIZE =
+        (sizeof(Chunk) + alignof(T) - 1) / alignof(T) * alignof(T);
+    static const std::size_t CHUNK_ALIGN =
+        alignof(T) > alignof(Chunk) ? alignof(T) : alignof(Chunk);
+    static const auto DEFAULT_CHUNK_SIZE = 256u;
+};
+
+}  // namespace structures
+
+// Construtor com blocos de tamanho padrão
+template<typename T>
+structures::SegmentedStack<T>::SegmentedStack() {
+    chunk_size_ = DEFAULT_CHUNK_SIZE;
+    resource_ = std::pmr::get_default_resource();
+}
+
+// Construtor com blocos de tamanho padrão e memória vinda de 'allocator'
+template<typename T>
+structures::SegmentedStack<T>::SegmentedStack(
+const std::pmr::polymorphic_allocator<T>& allocator) {
+    chunk_size_ = DEFAULT_CHUNK_SIZE;
+    resource_ = allocator.resource();
+}
+
+// Construtor com blocos de 'chunk_size' elementos
+template<typename T>
+structures::SegmentedStack<T>::SegmentedStack(std::size_t chunk_size,
+std::pmr::memory_resource* resource) {
+    if (chunk_size == 0) {
+        throw std::out_of_range("bloco vazio");
+    }
+    chunk_size_ = chunk_size;
+    resource_ = resource;
+}
+
+// Destrutor
+template<typename T>
+structures::SegmentedStack<T>::~SegmentedStack() {
+    clear();
+}
+
+// Empilha uma cópia do dado
+template<typename T>
+void structures::SegmentedStack<T>::push(const T& data) {
+    emplace(data);
+}
+
+// Empilha movendo o dado
+template<typename T>
+void structures::SegmentedStack<T>::push(T&& data) {
+    emplace(std::move(data));
+}
+
+// Constrói um elemento no topo, abrindo um bloco novo se o atual encheu
+template<typename T>
+template<typename... Args>
+T& structures::SegmentedStack<T>::emplace(Args&&... args) {
+    if (top_chunk_ == nullptr || top_count_ == chunk_size_) {
+        // constrói antes de trocar de bloco: 'args' pode ser o topo atual
+        T value(std::forward<Args>(args)...);
+        Chunk* chunk = allocate_chunk();
+        T* slot;
+        try {
+            slot = new (elements(chunk)) T(std::move(value));
+        } catch (...) {
+            spare_ = chunk;  // allocate_chunk deixou a reserva vazia
+            throw;
+        }
+        chunk->prev = top_chunk_;
+        top_chunk_ = chunk;
+        top_count_ = 1;
+        size_++;
+        return *slot;
+    }
+    T* slot = new (elements(top_chunk_) + top_count_)
+        T(std::forward<Args>(args)...);
+    top_count_++;
+    size_++;
+    return *slot;
+}
+
+// Desempilha o topo, movendo-o para fora
+template<typename T>
+T structures::SegmentedStack<T>::pop() {
+    if (empty()) {
+        throw std::out_of_range("pilha vazia");
+    }
+    T* slot = elements(top_chunk_) + top_count_ - 1;
+    T data(std::move(*slot));
+    slot->~T();
+    top_count_--;
+    size_--;
+    if (top_count_ == 0) {
+        // o bloco esvaziou: vira a reserva e o anterior (cheio) vira o topo
+        Chunk* chunk = top_chunk_;
+        top_chunk_ = chunk->prev;
+        top_count_ = top_chunk_ == nullptr ? 0 : chunk_size_;
+        if (spare_ != nullptr) {
+            deallocate_chunk(spare_);
+        }
+        spare_ = chunk;
+    }
+    return data;
+}
+
+// Consulta o elemento no topo da pilha
+template<typename T>
+T& structures::SegmentedStack<T>::top() {
+    if (empty()) {
+        throw std::out_of_range("pilha vazia");
+    }
+    return elements(top_chunk_)[top_count_ - 1];
+}
+
+// Esvazia a pilha e libera todos os blocos
+template<typename T>
+void structures::SegmentedStack<T>::clear() {
+    while (top_chunk_ != nullptr) {
+        T* first = elements(top_chunk_);
+        for (std::size_t i = top_count_; i > 0; i--) {
+            first[i - 1].~T();
+        }
+        Chunk* prev = top_chunk_->prev;
+        deallocate_chunk(top_chunk_);
+        top_chunk_ = prev;
+        top_count_ = chunk_size_;
+    }
+    if (spare_ != nullptr) {
+        deallocate_chunk(spare_);
+        spare_ = nullptr;
+    }
+    top_count_ = 0;
+    size_ = 0;
+}
+
+// Consulta o tamanho da pilha
+template<typename T>
+std::size_t structures::SegmentedStack<T>::size() const {
+    return size_;
+}
+
+// Verifica se a pilha está vazia
+template<typename T>
+bool structures::SegmentedStack<T>::empty() const {
+    return size_ == 0;
+}
+
+// Consulta o número de elementos por bloco
+template<typename T>
+std::size_t structures::SegmentedStack<T>::chunk_size() const {
+    return chunk_size_;
+}
+
+// Consulta a origem da memória da pilha
+template<typename T>
+std::pmr::memory_resource* structures::SegmentedStack<T>::resource() const {
+    return resource_;
+}
+
+// Usa o bloco reserva, se houver, ou aloca um novo
+template<typename T>
+typename structures::SegmentedStack<T>::Chunk*
+structures::SegmentedStack<T>::allocate_chunk() {
+    if (spare_ != nullptr) {
+        Chunk* chunk = spare_;
+        spare_ = nullptr;
+        return chunk;
+    }
+    return static_cast<Chunk*>(resource_->allocate(chunk_bytes(),
+                                                   CHUNK_ALIGN));
+}
+
+// Devolve um bloco (já sem elementos) para 'resource_'
+template<typename T>
+void structures::SegmentedStack<T>::deallocate_chunk(Chunk* chunk) {
+    resource_->deallocate(chunk, chunk_bytes(), CHUNK_ALIGN);
+}
+
+// Primeiro elemento de um bloco
+template<typename T>
+T* structures::SegmentedStack<T>::elements(Chunk* chunk) const {
+    return reinterpret_cast<T*>(reinterpret_cast<char*>(chunk) +
+                                HEADER_SIZE);
+}
+
+// Tamanho em bytes de um bloco
+template<typename T>
+std::size_t structures::SegmentedStack<T>::chunk_bytes() const {
+    return HEADER_SIZE + chunk_size_ * sizeof(T);
+}
+
+#endif
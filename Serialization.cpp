@@ -0,0 +1,171 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_SERIALIZATION_H
+#define STRUCTURES_SERIALIZATION_H
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace structures {
+
+//! Como um elemento é gravado e lido. O padrão grava os bytes do objeto e
+//! só existe para tipos trivialmente copiáveis; para outros tipos (ou para
+//! mudar o formato de um deles), especialize Codec<T> com
+//!     static void write(std::ostream& out, const T& value);
+//!     static T read(std::istream& in);
+//! Para tipos trivialmente copiáveis, se o codec também tiver write_n e
+//! read_n, os vetores contíguos são gravados e lidos em blocos por elas.
+template<typename T, typename Enable = void>
+struct Codec;
+
+template<typename T>
+struct Codec<T, std::enable_if_t<std::is_trivially_copyable<T>::value>> {
+    static void write(std::ostream& out, const T& value) {
+        write_n(out, &value, 1);
+    }
+
+    static T read(std::istream& in) {
+        T value;
+        read_n(in, &value, 1);
+        return value;
+    }
+
+    static void write_n(std::ostream& out, const T* values, std::size_t n) {
+        out.write(reinterpret_cast<const char*>(values),
+                  static_cast<std::streamsize>(n * sizeof(T)));
+    }
+
+    // 'values' pode ser memória bruta: os bytes lidos formam os objetos
+    static void read_n(std::istream& in, T* values, std::size_t n) {
+        in.read(reinterpret_cast<char*>(values),
+                static_cast<std::streamsize>(n * sizeof(T)));
+    }
+};
+
+namespace serialization {
+
+// Formato (na ordem de bytes da máquina):
+//   magic "STRC" | versão (u32) | sizeof(T) (u32) | quantidade (u64) |
+//   elementos, do primeiro ao último
+// O formato é o mesmo para todos os containers, então uma sequência salva
+// por um pode ser carregada por outro (a fila vai do início ao fim e a
+// pilha da base ao topo).
+const char MAGIC[4] = {'S', 'T', 'R', 'C'};
+const std::uint32_t VERSION = 1u;
+
+// Testa se Codec<T> grava e lê blocos inteiros (só para tipos
+// trivialmente copiáveis, cujos bytes podem ser lidos sobre qualquer posição)
+template<typename T, typename = void>
+struct has_block_codec : std::false_type {};
+
+template<typename T>
+struct has_block_codec<T, std::enable_if_t<
+    std::is_trivially_copyable<T>::value, std::void_t<
+    decltype(Codec<T>::write_n(std::declval<std::ostream&>(),
+                               std::declval<const T*>(), std::size_t{})),
+    decltype(Codec<T>::read_n(std::declval<std::istream&>(),
+                              std::declval<T*>(), std::size_t{}))>>>
+    : std::true_type {};
+
+// Lança um erro se a última operação no stream falhou
+inline void check(const std::ios& stream) {
+    if (!stream) {
+        throw std::runtime_error("falha de leitura/escrita na serialização");
+    }
+}
+
+// Grava o cabeçalho de uma sequência de 'count' elementos de T
+template<typename T>
+void write_header(std::ostream& out, std::uint64_t count) {
+    std::uint32_t version = VERSION;
+    std::uint32_t element_size = sizeof(T);
+    out.write(MAGIC, sizeof(MAGIC));
+    out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    out.write(reinterpret_cast<const char*>(&element_size),
+              sizeof(element_size));
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    check(out);
+}
+
+// Lê e valida o cabeçalho, retornando a quantidade de elementos
+template<typename T>
+std::uint64_t read_header(std::istream& in) {
+    char magic[sizeof(MAGIC)];
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint64_t count;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&element_size), sizeof(element_size));
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+    check(in);
+    if (!std::equal(magic, magic + sizeof(magic), MAGIC) ||
+        version != VERSION || element_size != sizeof(T)) {
+        throw std::runtime_error("formato de serialização inválido");
+    }
+    // um arquivo corrompido não pode pedir mais bytes do que cabem em um
+    // size_t (a conta do tamanho do vetor daria a volta)
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+        throw std::runtime_error("quantidade de elementos inválida");
+    }
+    return count;
+}
+
+// A quantidade do cabeçalho vem do stream: load() não reserva tudo de uma
+// vez, senão um stream truncado (ou corrompido) pede um vetor enorme e dá
+// std::bad_alloc em vez do erro de leitura. A capacidade cresce (dobrando,
+// ao menos LOAD_CHUNK elementos) conforme os elementos chegam.
+const std::size_t LOAD_CHUNK = 4096u;
+
+// Próxima capacidade de um vetor cheio com 'capacity' elementos durante a
+// leitura de uma sequência de 'count' (> capacity) elementos
+inline std::size_t load_capacity(std::size_t capacity, std::size_t count) {
+    std::size_t grown = capacity > count / 2 ? count : capacity * 2;
+    return std::min(count, std::max(grown, capacity + LOAD_CHUNK));
+}
+
+// Grava 'n' elementos contíguos, em um bloco quando o codec permite
+template<typename T>
+void write_elements(std::ostream& out, const T* values, std::size_t n) {
+    if constexpr (has_block_codec<T>::value) {
+        Codec<T>::write_n(out, values, n);
+    } else {
+        for (std::size_t i = 0; i < n; i++) {
+            Codec<T>::write(out, values[i]);
+        }
+    }
+    check(out);
+}
+
+// Lê 'n' elementos contíguos em um bloco (exige has_block_codec<T>)
+template<typename T>
+void read_elements(std::istream& in, T* values, std::size_t n) {
+    Codec<T>::read_n(in, values, n);
+    check(in);
+}
+
+// Grava um elemento
+template<typename T>
+void write_element(std::ostream& out, const T& value) {
+    Codec<T>::write(out, value);
+    check(out);
+}
+
+// Lê um elemento
+template<typename T>
+T read_element(std::istream& in) {
+    T value = Codec<T>::read(in);
+    check(in);
+    return value;
+}
+
+}  // namespace serialization
+
+}  // namespace structures
+
+#endif
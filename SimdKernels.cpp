@@ -0,0 +1,498 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_SIMD_KERNELS_H
+#define STRUCTURES_SIMD_KERNELS_H
+
+#include <cstdint>
+#include <type_traits>
+
+// Os kernels vetorizados só existem em x86 com GCC/Clang; nos demais
+// casos todas as funções caem no laço escalar
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    defined(__SSE2__)
+#define STRUCTURES_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace structures {
+
+//! Buscas e reduções sobre vetores contíguos. Para int32_t, int64_t, float
+//! e double há versões SSE2/AVX2 escolhidas em tempo de execução; os demais
+//! tipos usam o laço escalar. Com ponto flutuante, 'sum' soma em outra
+//! ordem que o laço escalar (o arredondamento pode diferir) e 'min'/'max'
+//! não têm resultado definido se houver NaN.
+namespace kernels {
+
+template<typename T>
+std::size_t find(const T* data, std::size_t n, const T& value);
+template<typename T>
+std::size_t count(const T* data, std::size_t n, const T& value);
+template<typename T>
+T min(const T* data, std::size_t n);  // n > 0
+template<typename T>
+T max(const T* data, std::size_t n);  // n > 0
+template<typename T>
+T sum(const T* data, std::size_t n);
+
+namespace detail {
+
+// Soma com estouro definido (módulo 2^n) para inteiros
+template<typename T>
+T add(T a, T b, std::true_type) {
+    using U = typename std::make_unsigned<T>::type;
+    return static_cast<T>(static_cast<U>(a) + static_cast<U>(b));
+}
+
+template<typename T>
+T add(T a, T b, std::false_type) {
+    return a + b;
+}
+
+template<typename T>
+T add(T a, T b) {
+    return add(a, b, std::is_integral<T>());
+}
+
+// Laços escalares, usados para tipos genéricos e para o resto dos vetores
+template<typename T>
+std::size_t scalar_find(const T* data, std::size_t i, std::size_t n,
+const T& value) {
+    for (; i < n; i++) {
+        if (value == data[i]) {
+            return i;
+        }
+    }
+    return n;
+}
+
+template<typename T>
+std::size_t scalar_count(const T* data, std::size_t i, std::size_t n,
+const T& value) {
+    std::size_t total = 0;
+    for (; i < n; i++) {
+        if (value == data[i]) {
+            total++;
+        }
+    }
+    return total;
+}
+
+template<typename T>
+T scalar_min(const T* data, std::size_t i, std::size_t n, T result) {
+    for (; i < n; i++) {
+        if (data[i] < result) {
+            result = data[i];
+        }
+    }
+    return result;
+}
+
+template<typename T>
+T scalar_max(const T* data, std::size_t i, std::size_t n, T result) {
+    for (; i < n; i++) {
+        if (result < data[i]) {
+            result = data[i];
+        }
+    }
+    return result;
+}
+
+template<typename T>
+T scalar_sum(const T* data, std::size_t i, std::size_t n, T result) {
+    for (; i < n; i++) {
+        result = add(result, data[i]);
+    }
+    return result;
+}
+
+#ifdef STRUCTURES_SIMD_X86
+
+// Detecta AVX2 uma única vez
+inline bool has_avx2() {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+}
+
+// Operações de cada conjunto de instruções. 'eq_mask' devolve um bit por
+// posição do vetor, como movemask.
+
+struct Sse2Int32 {
+    using value_type = std::int32_t;
+    using vec = __m128i;
+    static const std::size_t width = 4;
+    static vec load(const value_type* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    static void store(value_type* p, vec v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    static vec set1(value_type v) { return _mm_set1_epi32(v); }
+    static vec zero() { return _mm_setzero_si128(); }
+    static unsigned eq_mask(vec a, vec b) {
+        return static_cast<unsigned>(
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+    }
+    static vec add(vec a, vec b) { return _mm_add_epi32(a, b); }
+    static vec min(vec a, vec b) {  // SSE2 não tem min_epi32
+        __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+    }
+    static vec max(vec a, vec b) {
+        __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+    }
+};
+
+struct Sse2Int64 {
+    using value_type = std::int64_t;
+    using vec = __m128i;
+    static const std::size_t width = 2;
+    static vec load(const value_type* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    static void store(value_type* p, vec v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    static vec set1(value_type v) { return _mm_set1_epi64x(v); }
+    static vec zero() { return _mm_setzero_si128(); }
+    static unsigned eq_mask(vec a, vec b) {  // SSE2 não tem cmpeq_epi64
+        __m128i eq = _mm_cmpeq_epi32(a, b);
+        eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+        return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(eq)));
+    }
+    static vec add(vec a, vec b) { return _mm_add_epi64(a, b); }
+    // SSE2 não compara inteiros de 64 bits: min/max usam o laço escalar
+};
+
+struct Sse2Float {
+    using value_type = float;
+    using vec = __m128;
+    static const std::size_t width = 4;
+    static vec load(const value_type* p) { return _mm_loadu_ps(p); }
+    static void store(value_type* p, vec v) { _mm_storeu_ps(p, v); }
+    static vec set1(value_type v) { return _mm_set1_ps(v); }
+    static vec zero() { return _mm_setzero_ps(); }
+    static unsigned eq_mask(vec a, vec b) {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(a, b)));
+    }
+    static vec add(vec a, vec b) { return _mm_add_ps(a, b); }
+    static vec min(vec a, vec b) { return _mm_min_ps(a, b); }
+    static vec max(vec a, vec b) { return _mm_max_ps(a, b); }
+};
+
+struct Sse2Double {
+    using value_type = double;
+    using vec = __m128d;
+    static const std::size_t width = 2;
+    static vec load(const value_type* p) { return _mm_loadu_pd(p); }
+    static void store(value_type* p, vec v) { _mm_storeu_pd(p, v); }
+    static vec set1(value_type v) { return _mm_set1_pd(v); }
+    static vec zero() { return _mm_setzero_pd(); }
+    static unsigned eq_mask(vec a, vec b) {
+        return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpeq_pd(a, b)));
+    }
+    static vec add(vec a, vec b) { return _mm_add_pd(a, b); }
+    static vec min(vec a, vec b) { return _mm_min_pd(a, b); }
+    static vec max(vec a, vec b) { return _mm_max_pd(a, b); }
+};
+
+#define STRUCTURES_AVX2 __attribute__((target("avx2")))
+
+struct Avx2Int32 {
+    using value_type = std::int32_t;
+    using vec = __m256i;
+    static const std::size_t width = 8;
+    STRUCTURES_AVX2 static vec load(const value_type* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    STRUCTURES_AVX2 static void store(value_type* p, vec v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    STRUCTURES_AVX2 static vec set1(value_type v) {
+        return _mm256_set1_epi32(v);
+    }
+    STRUCTURES_AVX2 static vec zero() { return _mm256_setzero_si256(); }
+    STRUCTURES_AVX2 static unsigned eq_mask(vec a, vec b) {
+        return static_cast<unsigned>(_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+    }
+    STRUCTURES_AVX2 static vec add(vec a, vec b) {
+        return _mm256_add_epi32(a, b);
+    }
+    STRUCTURES_AVX2 static vec min(vec a, vec b) {
+        return _mm256_min_epi32(a, b);
+    }
+    STRUCTURES_AVX2 static vec max(vec a, vec b) {
+        return _mm256_max_epi32(a, b);
+    }
+};
+
+struct Avx2Int64 {
+    using value_type = std::int64_t;
+    using vec = __m256i;
+    static const std::size_t width = 4;
+    STRUCTURES_AVX2 static vec load(const value_type* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    STRUCTURES_AVX2 static void store(value_type* p, vec v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    STRUCTURES_AVX2 static vec set1(value_type v) {
+        return _mm256_set1_epi64x(v);
+    }
+    STRUCTURES_AVX2 static vec zero() { return _mm256_setzero_si256(); }
+    STRUCTURES_AVX2 static unsigned eq_mask(vec a, vec b) {
+        return static_cast<unsigned>(_mm256_movemask_pd(
+            _mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))));
+    }
+    STRUCTURES_AVX2 static vec add(vec a, vec b) {
+        return _mm256_add_epi64(a, b);
+    }
+    STRUCTURES_AVX2 static vec min(vec a, vec b) {
+        return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+    }
+    STRUCTURES_AVX2 static vec max(vec a, vec b) {
+        return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+    }
+};
+
+struct Avx2Float {
+    using value_type = float;
+    using vec = __m256;
+    static const std::size_t width = 8;
+    STRUCTURES_AVX2 static vec load(const value_type* p) {
+        return _mm256_loadu_ps(p);
+    }
+    STRUCTURES_AVX2 static void store(value_type* p, vec v) {
+        _mm256_storeu_ps(p, v);
+    }
+    STRUCTURES_AVX2 static vec set1(value_type v) { return _mm256_set1_ps(v); }
+    STRUCTURES_AVX2 static vec zero() { return _mm256_setzero_ps(); }
+    STRUCTURES_AVX2 static unsigned eq_mask(vec a, vec b) {
+        return static_cast<unsigned>(
+            _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+    STRUCTURES_AVX2 static vec add(vec a, vec b) { return _mm256_add_ps(a, b); }
+    STRUCTURES_AVX2 static vec min(vec a, vec b) { return _mm256_min_ps(a, b); }
+    STRUCTURES_AVX2 static vec max(vec a, vec b) { return _mm256_max_ps(a, b); }
+};
+
+struct Avx2Double {
+    using value_type = double;
+    using vec = __m256d;
+    static const std::size_t width = 4;
+    STRUCTURES_AVX2 static vec load(const value_type* p) {
+        return _mm256_loadu_pd(p);
+    }
+    STRUCTURES_AVX2 static void store(value_type* p, vec v) {
+        _mm256_storeu_pd(p, v);
+    }
+    STRUCTURES_AVX2 static vec set1(value_type v) { return _mm256_set1_pd(v); }
+    STRUCTURES_AVX2 static vec zero() { return _mm256_setzero_pd(); }
+    STRUCTURES_AVX2 static unsigned eq_mask(vec a, vec b) {
+        return static_cast<unsigned>(
+            _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+    }
+    STRUCTURES_AVX2 static vec add(vec a, vec b) { return _mm256_add_pd(a, b); }
+    STRUCTURES_AVX2 static vec min(vec a, vec b) { return _mm256_min_pd(a, b); }
+    STRUCTURES_AVX2 static vec max(vec a, vec b) { return _mm256_max_pd(a, b); }
+};
+
+// Algoritmos genéricos sobre as operações acima. São gerados uma vez para
+// cada conjunto de instruções porque o atributo 'target' precisa estar na
+// função que chama as intrínsecas para que elas sejam expandidas em linha.
+#define STRUCTURES_KERNEL_ALGORITHMS(ISA, ATTR)                              \
+template<typename Ops>                                                       \
+ATTR std::size_t ISA##_find(const typename Ops::value_type* data,            \
+std::size_t n, typename Ops::value_type value) {                             \
+    const std::size_t w = Ops::width;                                        \
+    const typename Ops::vec needle = Ops::set1(value);                       \
+    std::size_t i = 0;                                                       \
+    for (; i + 4 * w <= n; i += 4 * w) {                                     \
+        unsigned m0 = Ops::eq_mask(Ops::load(data + i), needle);             \
+        unsigned m1 = Ops::eq_mask(Ops::load(data + i + w), needle);         \
+        unsigned m2 = Ops::eq_mask(Ops::load(data + i + 2 * w), needle);     \
+        unsigned m3 = Ops::eq_mask(Ops::load(data + i + 3 * w), needle);     \
+        if ((m0 | m1 | m2 | m3) != 0) {                                      \
+            break;                                                           \
+        }                                                                    \
+    }                                                                        \
+    for (; i + w <= n; i += w) {                                             \
+        unsigned mask = Ops::eq_mask(Ops::load(data + i), needle);           \
+        if (mask != 0) {                                                     \
+            return i + static_cast<std::size_t>(__builtin_ctz(mask));        \
+        }                                                                    \
+    }                                                                        \
+    return scalar_find(data, i, n, value);                                   \
+}                                                                            \
+                                                                             \
+template<typename Ops>                                                       \
+ATTR std::size_t ISA##_count(const typename Ops::value_type* data,           \
+std::size_t n, typename Ops::value_type value) {                             \
+    const std::size_t w = Ops::width;                                        \
+    const typename Ops::vec needle = Ops::set1(value);                       \
+    std::size_t total = 0;                                                   \
+    std::size_t i = 0;                                                       \
+    for (; i + w <= n; i += w) {                                             \
+        total += static_cast<std::size_t>(__builtin_popcount(                \
+            Ops::eq_mask(Ops::load(data + i), needle)));                     \
+    }                                                                        \
+    return total + scalar_count(data, i, n, value);                          \
+}                                                                            \
+                                                                             \
+template<typename Ops>                                                       \
+ATTR typename Ops::value_type ISA##_min(                                     \
+const typename Ops::value_type* data, std::size_t n) {                       \
+    const std::size_t w = Ops::width;                                        \
+    if (n < w) {                                                             \
+        return scalar_min(data, 1, n, data[0]);                              \
+    }                                                                        \
+    typename Ops::vec acc = Ops::load(data);                                 \
+    std::size_t i = w;                                                       \
+    for (; i + w <= n; i += w) {                                             \
+        acc = Ops::min(acc, Ops::load(data + i));                            \
+    }                                                                        \
+    typename Ops::value_type lanes[Ops::width];                              \
+    Ops::store(lanes, acc);                                                  \
+    return scalar_min(data, i, n, scalar_min(lanes, 1, w, lanes[0]));        \
+}                                                                            \
+                                                                             \
+template<typename Ops>                                                       \
+ATTR typename Ops::value_type ISA##_max(                                     \
+const typename Ops::value_type* data, std::size_t n) {                       \
+    const std::size_t w = Ops::width;                                        \
+    if (n < w) {                                                             \
+        return scalar_max(data, 1, n, data[0]);                              \
+    }                                                                        \
+    typename Ops::vec acc = Ops::load(data);                                 \
+    std::size_t i = w;                                                       \
+    for (; i + w <= n; i += w) {                                             \
+        acc = Ops::max(acc, Ops::load(data + i));                            \
+    }                                                                        \
+    typename Ops::value_type lanes[Ops::width];                              \
+    Ops::store(lanes, acc);                                                  \
+    return scalar_max(data, i, n, scalar_max(lanes, 1, w, lanes[0]));        \
+}                                                                            \
+                                                                             \
+template<typename Ops>                                                       \
+ATTR typename Ops::value_type ISA##_sum(                                     \
+const typename Ops::value_type* data, std::size_t n) {                       \
+    const std::size_t w = Ops::width;                                        \
+    typename Ops::vec acc0 = Ops::zero();                                    \
+    typename Ops::vec acc1 = Ops::zero();                                    \
+    std::size_t i = 0;                                                       \
+    for (; i + 2 * w <= n; i += 2 * w) {                                     \
+        acc0 = Ops::add(acc0, Ops::load(data + i));                          \
+        acc1 = Ops::add(acc1, Ops::load(data + i + w));                      \
+    }                                                                        \
+    typename Ops::value_type lanes[Ops::width];                              \
+    Ops::store(lanes, Ops::add(acc0, acc1));                                 \
+    typename Ops::value_type total = scalar_sum(lanes, 0, w,                 \
+        typename Ops::value_type());                                         \
+    return scalar_sum(data, i, n, total);                                    \
+}
+
+STRUCTURES_KERNEL_ALGORITHMS(sse2, )
+STRUCTURES_KERNEL_ALGORITHMS(avx2, STRUCTURES_AVX2)
+
+#undef STRUCTURES_KERNEL_ALGORITHMS
+#undef STRUCTURES_AVX2
+
+#endif  // STRUCTURES_SIMD_X86
+
+}  // namespace detail
+
+// Versões vetorizadas para os tipos aritméticos suportados
+#ifdef STRUCTURES_SIMD_X86
+
+#define STRUCTURES_KERNEL_DISPATCH(TYPE, SSE2, AVX2, SSE2_MINMAX)            \
+inline std::size_t find(const TYPE* data, std::size_t n, const TYPE& value) { \
+    if (detail::has_avx2()) {                                                \
+        return detail::avx2_find<detail::AVX2>(data, n, value);              \
+    }                                                                        \
+    return detail::sse2_find<detail::SSE2>(data, n, value);                  \
+}                                                                            \
+inline std::size_t count(const TYPE* data, std::size_t n,                    \
+const TYPE& value) {                                                         \
+    if (detail::has_avx2()) {                                                \
+        return detail::avx2_count<detail::AVX2>(data, n, value);             \
+    }                                                                        \
+    return detail::sse2_count<detail::SSE2>(data, n, value);                 \
+}                                                                            \
+inline TYPE min(const TYPE* data, std::size_t n) {                           \
+    if (detail::has_avx2()) {                                                \
+        return detail::avx2_min<detail::AVX2>(data, n);                      \
+    }                                                                        \
+    return SSE2_MINMAX(min, SSE2);                                           \
+}                                                                            \
+inline TYPE max(const TYPE* data, std::size_t n) {                           \
+    if (detail::has_avx2()) {                                                \
+        return detail::avx2_max<detail::AVX2>(data, n);                      \
+    }                                                                        \
+    return SSE2_MINMAX(max, SSE2);                                           \
+}                                                                            \
+inline TYPE sum(const TYPE* data, std::size_t n) {                           \
+    if (detail::has_avx2()) {                                                \
+        return detail::avx2_sum<detail::AVX2>(data, n);                      \
+    }                                                                        \
+    return detail::sse2_sum<detail::SSE2>(data, n);                          \
+}
+
+#define STRUCTURES_SSE2_MINMAX(OP, SSE2) \
+    detail::sse2_##OP<detail::SSE2>(data, n)
+#define STRUCTURES_SCALAR_MINMAX(OP, SSE2) \
+    detail::scalar_##OP(data, 1, n, data[0])
+
+STRUCTURES_KERNEL_DISPATCH(std::int32_t, Sse2Int32, Avx2Int32,
+                           STRUCTURES_SSE2_MINMAX)
+STRUCTURES_KERNEL_DISPATCH(std::int64_t, Sse2Int64, Avx2Int64,
+                           STRUCTURES_SCALAR_MINMAX)
+STRUCTURES_KERNEL_DISPATCH(float, Sse2Float, Avx2Float,
+                           STRUCTURES_SSE2_MINMAX)
+STRUCTURES_KERNEL_DISPATCH(double, Sse2Double, Avx2Double,
+                           STRUCTURES_SSE2_MINMAX)
+
+#undef STRUCTURES_KERNEL_DISPATCH
+#undef STRUCTURES_SSE2_MINMAX
+#undef STRUCTURES_SCALAR_MINMAX
+
+#endif  // STRUCTURES_SIMD_X86
+
+}  // namespace kernels
+}  // namespace structures
+
+// Busca o index da primeira ocorrência de 'value', ou n se não houver
+template<typename T>
+std::size_t structures::kernels::find(const T* data, std::size_t n,
+const T& value) {
+    return detail::scalar_find(data, 0, n, value);
+}
+
+// Conta as ocorrências de 'value'
+template<typename T>
+std::size_t structures::kernels::count(const T* data, std::size_t n,
+const T& value) {
+    return detail::scalar_count(data, 0, n, value);
+}
+
+// Menor elemento
+template<typename T>
+T structures::kernels::min(const T* data, std::size_t n) {
+    return detail::scalar_min(data, 1, n, data[0]);
+}
+
+// Maior elemento
+template<typename T>
+T structures::kernels::max(const T* data, std::size_t n) {
+    return detail::scalar_max(data, 1, n, data[0]);
+}
+
+// Soma dos elementos
+template<typename T>
+T structures::kernels::sum(const T* data, std::size_t n) {
+    return detail::scalar_sum(data, 0, n, T());
+}
+
+#endif
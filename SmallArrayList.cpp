@@ -0,0 +1,84 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_SMALL_ARRAY_LIST_H
+#define STRUCTURES_SMALL_ARRAY_LIST_H
+
+#include <cstdint>
+#include <memory_resource>
+
+#include "./ArrayList.cpp"
+
+namespace structures {
+
+namespace detail {
+
+// Buffer bruto para N elementos dentro do próprio objeto. É uma base (e não
+// um membro) para existir antes do construtor de ArrayList usá-lo.
+template<typename T, std::size_t N>
+struct InlineStorage {
+    alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+    T* inline_buffer() {
+        return reinterpret_cast<T*>(buffer_);
+    }
+
+    const T* inline_buffer() const {
+        return reinterpret_cast<const T*>(buffer_);
+    }
+};
+
+}  // namespace detail
+
+//! ArrayList que guarda até N elementos dentro do objeto e só usa o heap
+//! quando cresce além disso. Tem a mesma interface de ArrayList.
+template<typename T, std::size_t N>
+class SmallArrayList : private detail::InlineStorage<T, N>,
+                       public ArrayList<T> {
+    static_assert(N > 0, "SmallArrayList precisa de capacidade interna");
+
+ public:
+    static const std::size_t inline_capacity = N;
+
+    SmallArrayList();
+    explicit SmallArrayList(
+        const std::pmr::polymorphic_allocator<T>& allocator);
+    explicit SmallArrayList(double growth_factor,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    SmallArrayList(const SmallArrayList&) = delete;
+    SmallArrayList& operator=(const SmallArrayList&) = delete;
+
+    bool is_inline() const;  // elementos ainda no buffer interno
+
+ private:
+    static constexpr double DEFAULT_GROWTH = 2.0;
+};
+
+}  // namespace structures
+
+// Construtor padrão: cresce para o heap quando passar de N elementos
+template<typename T, std::size_t N>
+structures::SmallArrayList<T, N>::SmallArrayList():
+    ArrayList<T>(this->inline_buffer(), N, DEFAULT_GROWTH,
+                 std::pmr::get_default_resource())
+{}
+
+// Construtor com o heap vindo de 'allocator'
+template<typename T, std::size_t N>
+structures::SmallArrayList<T, N>::SmallArrayList(
+const std::pmr::polymorphic_allocator<T>& allocator):
+    ArrayList<T>(this->inline_buffer(), N, DEFAULT_GROWTH, allocator.resource())
+{}
+
+// Construtor com fator de crescimento (0 limita a lista a N elementos)
+template<typename T, std::size_t N>
+structures::SmallArrayList<T, N>::SmallArrayList(double growth_factor,
+std::pmr::memory_resource* resource):
+    ArrayList<T>(this->inline_buffer(), N, growth_factor, resource)
+{}
+
+// Testa se os elementos ainda estão no buffer interno
+template<typename T, std::size_t N>
+bool structures::SmallArrayList<T, N>::is_inline() const {
+    return this->data() == this->inline_buffer();
+}
+
+#endif
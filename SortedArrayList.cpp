@@ -0,0 +1,343 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_SORTED_ARRAY_LIST_H
+#define STRUCTURES_SORTED_ARRAY_LIST_H
+
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+
+#include "./ArrayList.cpp"
+
+namespace structures {
+
+//! Lista em vetor mantida sempre em ordem, com busca binária. As operações
+//! por valor (find, contains, remove, lower_bound...) não lançam com a lista
+//! vazia: find devolve size() e remove não faz nada quando não há elemento
+//! equivalente. As operações por posição (at, pop, pop_back, pop_front)
+//! lançam std::out_of_range, como na ArrayList.
+template<typename T, typename Compare = std::less<T>>
+class SortedArrayList {
+ public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_iterator = const T*;
+    using iterator = const_iterator;  // escrever quebraria a ordem
+
+    SortedArrayList();
+    explicit SortedArrayList(
+        const std::pmr::polymorphic_allocator<T>& allocator);
+    explicit SortedArrayList(const Compare& compare,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    explicit SortedArrayList(std::size_t max_size,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    SortedArrayList(std::size_t max_size, const Compare& compare,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    SortedArrayList(std::size_t max_size, double growth_factor,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    SortedArrayList(std::size_t max_size, double growth_factor,
+        const Compare& compare,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    void clear();
+    std::size_t insert(const T& data);  // retorna a posição inserida
+    std::size_t insert(T&& data);
+    std::size_t insert_sorted(const T& data);  // igual a 'insert'
+    T pop(std::size_t index);
+    T pop_back();
+    T pop_front();
+    void remove(const T& data);
+    bool full() const;
+    bool empty() const;
+    bool contains(const T& data) const;
+    std::size_t find(const T& data) const;
+    std::size_t lower_bound(const T& data) const;
+    std::size_t upper_bound(const T& data) const;
+    std::pair<std::size_t, std::size_t> equal_range(const T& data) const;
+    std::size_t size() const;
+    std::size_t max_size() const;
+    std::size_t capacity() const;
+    void reserve(std::size_t new_capacity);
+    void shrink_to_fit();
+    // só há acesso constante: escrever nos elementos quebraria a ordem
+    const T& at(std::size_t index) const;
+    const T& operator[](std::size_t index) const;
+    const T* data() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+
+ private:
+    ArrayList<T> list;
+    Compare compare_;
+};
+
+}  // namespace structures
+
+// Construtor com tamanho padrão
+template<typename T, typename Compare>
+structures::SortedArrayList<T, Compare>::SortedArrayList():
+    list{},
+    compare_{}
+{}
+
+// Construtor com tamanho padrão e memória vinda de 'allocator'
+template<typename T, typename Compare>
+structures::SortedArrayList<T, Compare>::SortedArrayList(
+const std::pmr::polymorphic_allocator<T>& allocator):
+    list(allocator.resource()),
+    compare_{}
+{}
+
+// Construtor com tamanho padrão e comparador específico
+template<typename T, typename Compare>
+structures::SortedArrayList<T, Compare>::SortedArrayList(
+const Compare& compare, std::pmr::memory_resource* resource):
+    list(resource),
+    compare_{compare}
+{}
+
+// Construtor com tamanho específico
+template<typename T, typename Compare>
+structures::SortedArrayList<T, Compare>::SortedArrayList(
+std::size_t max_size, std::pmr::memory_resource* resource):
+    list(max_size, resource),
+    compare_{}
+{}
+
+// Construtor com tamanho e comparador específicos
+template<typename T, typename Compare>
+structures::SortedArrayList<T, Compare>::SortedArrayList(
+std::size_t max_size, const Compare& compare,
+std::pmr::memory_resource* resource):
+    list(max_size, resource),
+    compare_{compare}
+{}
+
+// Construtor com tamanho inicial e fator de crescimento
+template<typename T, typename Compare>
+structures::SortedArrayList<T, Compare>::SortedArrayList(std::size_t max_size,
+double growth_factor, std::pmr::memory_resource* resource):
+    list(max_size, growth_factor, resource),
+    compare_{}
+{}
+
+// Construtor com comparador específico
+template<typename T, typename Compare>
+structures::SortedArrayList<T, Compare>::SortedArrayList(std::size_t max_size,
+double growth_factor, const Compare& compare,
+std::pmr::memory_resource* resource):
+    list(max_size, growth_factor, resource),
+    compare_{compare}
+{}
+
+// Limpa a lista
+template<typename T, typename Compare>
+void structures::SortedArrayList<T, Compare>::clear() {
+    list.clear();
+}
+
+// Insere um elemento na sua posição ordenada
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::insert(const T& data) {
+    std::size_t index = lower_bound(data);
+    list.insert(data, index);
+    return index;
+}
+
+// Insere um elemento na sua posição ordenada movendo o dado
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::insert(T&& data) {
+    std::size_t index = lower_bound(data);
+    list.insert(std::move(data), index);
+    return index;
+}
+
+// Insere um elemento em ordem (mesma interface de ArrayList)
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::insert_sorted(
+const T& data) {
+    return insert(data);
+}
+
+// Retira um elemento de uma posição específica
+template<typename T, typename Compare>
+T structures::SortedArrayList<T, Compare>::pop(std::size_t index) {
+    return list.pop(index);
+}
+
+// Retira o maior elemento
+template<typename T, typename Compare>
+T structures::SortedArrayList<T, Compare>::pop_back() {
+    return list.pop_back();
+}
+
+// Retira o menor elemento
+template<typename T, typename Compare>
+T structures::SortedArrayList<T, Compare>::pop_front() {
+    return list.pop_front();
+}
+
+// Retira a primeira ocorrência de um elemento equivalente, se houver
+template<typename T, typename Compare>
+void structures::SortedArrayList<T, Compare>::remove(const T& data) {
+    std::size_t index = find(data);
+    if (index != size()) {
+        list.pop(index);
+    }
+}
+
+// Testa se a lista está cheia
+template<typename T, typename Compare>
+bool structures::SortedArrayList<T, Compare>::full() const {
+    return list.full();
+}
+
+// Testa se a lista está vazia
+template<typename T, typename Compare>
+bool structures::SortedArrayList<T, Compare>::empty() const {
+    return list.empty();
+}
+
+// Testa se a lista contém um elemento equivalente, em O(log n)
+template<typename T, typename Compare>
+bool structures::SortedArrayList<T, Compare>::contains(const T& data) const {
+    return find(data) != size();
+}
+
+// Procura o index do primeiro elemento equivalente, ou size() se não houver
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::find(
+const T& data) const {
+    std::size_t index = lower_bound(data);
+    if (index < size() && !compare_(data, list[index])) {
+        return index;
+    }
+    return size();
+}
+
+// Primeira posição cujo elemento não é menor que 'data'
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::lower_bound(
+const T& data) const {
+    std::size_t first = 0;
+    std::size_t count = size();
+    while (count > 0) {
+        std::size_t step = count / 2;
+        if (compare_(list[first + step], data)) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+// Primeira posição cujo elemento é maior que 'data'
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::upper_bound(
+const T& data) const {
+    std::size_t first = 0;
+    std::size_t count = size();
+    while (count > 0) {
+        std::size_t step = count / 2;
+        if (!compare_(data, list[first + step])) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+// Intervalo [first, second) dos elementos equivalentes a 'data'
+template<typename T, typename Compare>
+std::pair<std::size_t, std::size_t>
+structures::SortedArrayList<T, Compare>::equal_range(const T& data) const {
+    return std::make_pair(lower_bound(data), upper_bound(data));
+}
+
+// Retorna o tamanho da lista
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::size() const {
+    return list.size();
+}
+
+// Retorna o tamanho máximo da lista
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::max_size() const {
+    return list.max_size();
+}
+
+// Retorna a capacidade atual da lista
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::capacity() const {
+    return list.capacity();
+}
+
+// Garante capacidade para pelo menos 'new_capacity' elementos
+template<typename T, typename Compare>
+void structures::SortedArrayList<T, Compare>::reserve(
+std::size_t new_capacity) {
+    list.reserve(new_capacity);
+}
+
+// Reduz a capacidade ao número de elementos da lista
+template<typename T, typename Compare>
+void structures::SortedArrayList<T, Compare>::shrink_to_fit() {
+    list.shrink_to_fit();
+}
+
+// Retorna como constante o elemento de uma posição em específico
+template<typename T, typename Compare>
+const T& structures::SortedArrayList<T, Compare>::at(
+std::size_t index) const {
+    return list.at(index);
+}
+
+// Acesso constante aos elementos pelo operador []
+template<typename T, typename Compare>
+const T& structures::SortedArrayList<T, Compare>::operator[](
+std::size_t index) const {
+    return list[index];
+}
+
+// Ponteiro constante para o primeiro elemento
+template<typename T, typename Compare>
+const T* structures::SortedArrayList<T, Compare>::data() const {
+    return list.data();
+}
+
+// Iterador constante para o início da lista
+template<typename T, typename Compare>
+typename structures::SortedArrayList<T, Compare>::const_iterator
+structures::SortedArrayList<T, Compare>::begin() const {
+    return list.begin();
+}
+
+// Iterador constante para depois do último elemento da lista
+template<typename T, typename Compare>
+typename structures::SortedArrayList<T, Compare>::const_iterator
+structures::SortedArrayList<T, Compare>::end() const {
+    return list.end();
+}
+
+// Iterador constante para o início da lista
+template<typename T, typename Compare>
+typename structures::SortedArrayList<T, Compare>::const_iterator
+structures::SortedArrayList<T, Compare>::cbegin() const {
+    return list.cbegin();
+}
+
+// Iterador constante para depois do último elemento da lista
+template<typename T, typename Compare>
+typename structures::SortedArrayList<T, Compare>::const_iterator
+structures::SortedArrayList<T, Compare>::cend() const {
+    return list.cend();
+}
+
+#endif
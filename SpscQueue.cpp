@@ -0,0 +1,194 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_SPSC_QUEUE_H
+#define STRUCTURES_SPSC_QUEUE_H
+
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::size_t
+#include <limits>  // std::numeric_limits
+#include <memory_resource>  // std::pmr::memory_resource
+#include <new>  // placement new, std::bad_array_new_length
+#include <utility>  // std::move, std::forward
+
+namespace structures {
+
+//! Tamanho de linha de cache usado para separar os índices das filas
+//! concorrentes (64 bytes nos x86 e na maioria dos ARM)
+static const std::size_t CACHE_LINE = 64u;
+
+template<typename T>
+//! Fila circular sem travas para um único produtor e um único consumidor.
+//! Só a thread produtora pode chamar try_enqueue/try_emplace e só a
+//! consumidora pode chamar try_dequeue; o resto pode ser chamado de
+//! qualquer uma das duas, mas o resultado é só uma estimativa.
+class SpscQueue {
+ public:
+    //! construtor padrao
+    SpscQueue();
+    //! construtor com origem da memoria
+    explicit SpscQueue(const std::pmr::polymorphic_allocator<T>& allocator);
+    //! construtor com parametro
+    explicit SpscQueue(std::size_t max,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    //! destrutor padrao
+    ~SpscQueue();
+    //! produtor: enfileira uma copia; false se a fila estiver cheia
+    bool try_enqueue(const T& data);
+    //! produtor: enfileira movendo o dado; false se a fila estiver cheia
+    bool try_enqueue(T&& data);
+    //! produtor: constroi o elemento no fim da fila
+    template<typename... Args>
+    bool try_emplace(Args&&... args);
+    //! consumidor: move o inicio da fila para 'data'; false se vazia
+    bool try_dequeue(T& data);
+    //! tamanho aproximado (exato se nenhuma thread estiver mexendo)
+    std::size_t size() const;
+    //! tamanho maximo
+    std::size_t max_size() const;
+    //! fila vazia (aproximado)
+    bool empty() const;
+    //! origem da memoria
+    std::pmr::memory_resource* resource() const;
+
+ private:
+    // Um índice a mais que 'max' distingue a fila cheia da vazia sem um
+    // contador compartilhado: cheia é tail + 1 == head.
+    std::size_t next(std::size_t index) const;
+
+    // lado do consumidor
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_{0u};
+    std::size_t tail_cache_{0u};  // última cauda vista pelo consumidor
+
+    // lado do produtor
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0u};
+    std::size_t head_cache_{0u};  // última cabeça vista pelo produtor
+
+    // só lidos depois da construção
+    alignas(CACHE_LINE) T* contents;  // memória bruta
+    std::size_t capacity_;  // max + 1 posições
+    std::pmr::memory_resource* resource_;
+
+    static const auto DEFAULT_SIZE = 10u;
+};
+
+}  // namespace structures
+
+// Construtor com tamanho padrão
+template<typename T>
+structures::SpscQueue<T>::SpscQueue():
+    SpscQueue(DEFAULT_SIZE)
+{}
+
+// Construtor com tamanho padrão e memória vinda de 'allocator'
+template<typename T>
+structures::SpscQueue<T>::SpscQueue(
+const std::pmr::polymorphic_allocator<T>& allocator):
+    SpscQueue(DEFAULT_SIZE, allocator.resource())
+{}
+
+// Construtor com tamanho específico (lança std::bad_array_new_length se
+// (max + 1) * sizeof(T) não couber em um size_t)
+template<typename T>
+structures::SpscQueue<T>::SpscQueue(std::size_t max,
+std::pmr::memory_resource* resource) {
+    if (max >= std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+        throw std::bad_array_new_length();
+    }
+    capacity_ = max + 1;
+    resource_ = resource;
+    contents = static_cast<T*>(
+        resource_->allocate(capacity_ * sizeof(T), alignof(T)));
+}
+
+// Destrutor: destrói o que ficou na fila
+template<typename T>
+structures::SpscQueue<T>::~SpscQueue() {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    for (; head != tail; head = next(head)) {
+        contents[head].~T();
+    }
+    resource_->deallocate(contents, capacity_ * sizeof(T), alignof(T));
+}
+
+// Enfileira uma cópia do dado
+template<typename T>
+bool structures::SpscQueue<T>::try_enqueue(const T& data) {
+    return try_emplace(data);
+}
+
+// Enfileira movendo o dado
+template<typename T>
+bool structures::SpscQueue<T>::try_enqueue(T&& data) {
+    return try_emplace(std::move(data));
+}
+
+// Constrói um elemento no fim da fila. Só relê a cabeça (a linha de cache
+// do consumidor) quando a cópia local indica fila cheia.
+template<typename T>
+template<typename... Args>
+bool structures::SpscQueue<T>::try_emplace(Args&&... args) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    std::size_t next_tail = next(tail);
+    if (next_tail == head_cache_) {
+        head_cache_ = head_.load(std::memory_order_acquire);
+        if (next_tail == head_cache_) {
+            return false;
+        }
+    }
+    new (contents + tail) T(std::forward<Args>(args)...);
+    tail_.store(next_tail, std::memory_order_release);
+    return true;
+}
+
+// Retira o elemento do início da fila
+template<typename T>
+bool structures::SpscQueue<T>::try_dequeue(T& data) {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+        tail_cache_ = tail_.load(std::memory_order_acquire);
+        if (head == tail_cache_) {
+            return false;
+        }
+    }
+    data = std::move(contents[head]);
+    contents[head].~T();
+    head_.store(next(head), std::memory_order_release);
+    return true;
+}
+
+// Consulta o tamanho da fila
+template<typename T>
+std::size_t structures::SpscQueue<T>::size() const {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    return tail >= head ? tail - head : capacity_ - head + tail;
+}
+
+// Consulta o tamanho máximo da fila
+template<typename T>
+std::size_t structures::SpscQueue<T>::max_size() const {
+    return capacity_ - 1;
+}
+
+// Verifica se a fila está vazia
+template<typename T>
+bool structures::SpscQueue<T>::empty() const {
+    return head_.load(std::memory_order_acquire) ==
+           tail_.load(std::memory_order_acquire);
+}
+
+// Consulta a origem da memória da fila
+template<typename T>
+std::pmr::memory_resource* structures::SpscQueue<T>::resource() const {
+    return resource_;
+}
+
+// Próxima posição do vetor circular
+template<typename T>
+std::size_t structures::SpscQueue<T>::next(std::size_t index) const {
+    return index + 1 == capacity_ ? 0 : index + 1;
+}
+
+#endif
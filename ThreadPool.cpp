@@ -0,0 +1,371 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_THREAD_POOL_H
+#define STRUCTURES_THREAD_POOL_H
+
+#include <algorithm>  // std::min
+#include <atomic>  // std::atomic
+#include <condition_variable>  // std::condition_variable
+#include <cstdint>  // std::size_t, std::int64_t
+#include <exception>  // std::exception_ptr
+#include <functional>  // std::function
+#include <memory>  // std::unique_ptr
+#include <mutex>  // std::mutex, std::lock_guard, std::unique_lock
+#include <thread>  // std::thread
+#include <utility>  // std::forward
+#include <vector>  // std::vector
+
+#include "./ArrayQueue.cpp"
+#include "./WorkStealingDeque.cpp"
+
+namespace structures {
+
+//! Pool com um número fixo de threads e roubo de tarefas. Cada thread tem
+//! uma WorkStealingDeque: as tarefas criadas por ela vão para o fundo da
+//! própria deque e são executadas em ordem LIFO, e uma thread sem trabalho
+//! rouba do topo da deque das outras. Tarefas criadas fora do pool entram
+//! em uma ArrayQueue protegida por trava. A primeira exceção de uma tarefa
+//! é relançada por wait().
+class ThreadPool {
+ public:
+    //! construtor com uma thread por nucleo
+    ThreadPool();
+    //! construtor com o numero de threads
+    explicit ThreadPool(std::size_t threads);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    //! destrutor: termina as tarefas pendentes e encerra as threads
+    ~ThreadPool();
+    //! cria uma tarefa
+    template<typename F>
+    void spawn(F&& task);
+    //! espera todas as tarefas (nao chamar de dentro de uma tarefa)
+    void wait();
+    //! executa body(i) para i em [first, last), em blocos, e espera; pode
+    //! ser chamado de dentro de uma tarefa
+    template<typename F>
+    void parallel_for(std::size_t first, std::size_t last, F&& body);
+    //! idem, com blocos de 'grain' indices
+    template<typename F>
+    void parallel_for(std::size_t first, std::size_t last, std::size_t grain,
+                      F&& body);
+    //! numero de threads
+    std::size_t size() const;
+
+ private:
+    using Task = std::function<void()>;
+
+    // Pool e índice da thread atual, se ela for uma das threads de um pool
+    struct Worker {
+        ThreadPool* pool;
+        std::size_t index;
+    };
+
+    static Worker& current();
+    void start(std::size_t threads);
+    void stop();
+    void enqueue(Task* task);
+    Task* find_task();
+    bool run_one();
+    void execute(Task* task);
+    void finish();
+    void help_until(const std::atomic<std::size_t>& remaining);
+    void worker_loop(std::size_t index);
+
+    std::size_t size_;
+    std::unique_ptr<WorkStealingDeque<Task*>[]> deques_;
+    std::vector<std::thread> threads_;
+
+    std::mutex queue_mutex_;
+    ArrayQueue<Task*> injected_;  // tarefas criadas fora do pool
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;  // há tarefa na fila ou stop
+    std::condition_variable done_cv_;  // pending_ chegou a 0
+    bool stopping_{false};
+    std::exception_ptr error_;
+
+    std::atomic<std::int64_t> queued_{0};  // criadas e ainda não pegas
+    std::atomic<std::size_t> pending_{0u};  // criadas e não terminadas
+    std::atomic<std::size_t> sleeping_{0u};
+
+    static const auto DEFAULT_QUEUE_SIZE = 64u;
+    static const auto CHUNKS_PER_THREAD = 4u;
+};
+
+}  // namespace structures
+
+// Construtor com uma thread por núcleo
+inline structures::ThreadPool::ThreadPool():
+    injected_(DEFAULT_QUEUE_SIZE, QueueMode::growable)
+{
+    start(std::thread::hardware_concurrency());
+}
+
+// Construtor com 'threads' threads (ao menos uma)
+inline structures::ThreadPool::ThreadPool(std::size_t threads):
+    injected_(DEFAULT_QUEUE_SIZE, QueueMode::growable)
+{
+    start(threads);
+}
+
+// Destrutor
+inline structures::ThreadPool::~ThreadPool() {
+    stop();
+}
+
+// Cria uma tarefa: na deque da thread atual, se ela for do pool, ou na
+// fila de entrada
+template<typename F>
+void structures::ThreadPool::spawn(F&& task) {
+    Task* created = new Task(std::forward<F>(task));
+    try {
+        enqueue(created);
+    } catch (...) {
+        delete created;
+        throw;
+    }
+}
+
+// Espera até todas as tarefas terminarem, ajudando a executá-las, e
+// relança a primeira exceção de uma delas
+inline void structures::ThreadPool::wait() {
+    while (pending_.load() != 0) {
+        if (run_one()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] {
+            return pending_.load() == 0;
+        });
+    }
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error = error_;
+        error_ = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// Divide [first, last) em alguns blocos por thread
+template<typename F>
+void structures::ThreadPool::parallel_for(std::size_t first,
+std::size_t last, F&& body) {
+    if (first >= last) {
+        return;
+    }
+    std::size_t chunks = size_ * CHUNKS_PER_THREAD;
+    std::size_t grain = (last - first + chunks - 1) / chunks;
+    parallel_for(first, last, grain, std::forward<F>(body));
+}
+
+// Cria uma tarefa por bloco de 'grain' índices e executa tarefas até os
+// blocos terminarem (em vez de dormir, o que permite chamar de dentro de
+// uma tarefa); relança a primeira exceção de 'body', ou a de spawn depois
+// que os blocos já criados terminarem
+template<typename F>
+void structures::ThreadPool::parallel_for(std::size_t first,
+std::size_t last, std::size_t grain, F&& body) {
+    if (first >= last) {
+        return;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+    std::size_t chunks = (last - first + grain - 1) / grain;
+    if (chunks == 1) {
+        for (std::size_t i = first; i < last; i++) {
+            body(i);
+        }
+        return;
+    }
+    std::atomic<std::size_t> remaining{chunks};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    std::size_t spawned = 0;
+    try {
+        for (std::size_t begin = first; begin < last; begin += grain) {
+            std::size_t end = std::min(last, begin + grain);
+            spawn([&, begin, end] {
+                try {
+                    for (std::size_t i = begin; i < end; i++) {
+                        body(i);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                remaining.fetch_sub(1, std::memory_order_release);
+            });
+            spawned++;
+        }
+    } catch (...) {
+        // os blocos já criados usam as variáveis locais: espera por eles
+        // antes de sair
+        remaining.fetch_sub(chunks - spawned, std::memory_order_release);
+        help_until(remaining);
+        throw;
+    }
+    help_until(remaining);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// Consulta o número de threads
+inline std::size_t structures::ThreadPool::size() const {
+    return size_;
+}
+
+// Identidade da thread atual
+inline structures::ThreadPool::Worker& structures::ThreadPool::current() {
+    thread_local Worker worker{nullptr, 0u};
+    return worker;
+}
+
+// Cria as deques e as threads
+inline void structures::ThreadPool::start(std::size_t threads) {
+    size_ = threads == 0 ? 1 : threads;
+    deques_.reset(new WorkStealingDeque<Task*>[size_]);
+    threads_.reserve(size_);
+    try {
+        for (std::size_t i = 0; i < size_; i++) {
+            threads_.emplace_back([this, i] {
+                worker_loop(i);
+            });
+        }
+    } catch (...) {
+        stop();
+        throw;
+    }
+}
+
+// Avisa as threads para sair depois de esvaziar as filas e espera por elas
+inline void structures::ThreadPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+// Publica uma tarefa e acorda uma thread se houver alguma dormindo
+inline void structures::ThreadPool::enqueue(Task* task) {
+    pending_.fetch_add(1);
+    queued_.fetch_add(1);
+    try {
+        Worker& worker = current();
+        if (worker.pool == this) {
+            deques_[worker.index].push(task);
+        } else {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            injected_.enqueue(task);
+        }
+    } catch (...) {
+        queued_.fetch_sub(1);
+        finish();
+        throw;
+    }
+    // queued_ e sleeping_ são seq_cst: ou quem vai dormir vê a tarefa, ou
+    // aqui se vê quem dorme
+    if (sleeping_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        work_cv_.notify_one();
+    }
+}
+
+// Procura uma tarefa: na própria deque, na fila de entrada e então nas
+// deques das outras threads
+inline structures::ThreadPool::Task* structures::ThreadPool::find_task() {
+    Task* task = nullptr;
+    Worker& worker = current();
+    bool inside = worker.pool == this;
+    if (inside && deques_[worker.index].pop(task)) {
+        return task;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (!injected_.empty()) {
+            return injected_.dequeue();
+        }
+    }
+    std::size_t start = inside ? worker.index + 1 : 0;
+    for (std::size_t k = 0; k < size_; k++) {
+        if (deques_[(start + k) % size_].steal(task)) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+// Executa uma tarefa, se achar alguma
+inline bool structures::ThreadPool::run_one() {
+    Task* task = find_task();
+    if (task == nullptr) {
+        return false;
+    }
+    queued_.fetch_sub(1);
+    execute(task);
+    return true;
+}
+
+// Executa e libera uma tarefa, guardando a primeira exceção
+inline void structures::ThreadPool::execute(Task* task) {
+    try {
+        (*task)();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) {
+            error_ = std::current_exception();
+        }
+    }
+    delete task;
+    finish();
+}
+
+// Conta uma tarefa terminada e acorda wait() se foi a última
+inline void structures::ThreadPool::finish() {
+    if (pending_.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_cv_.notify_all();
+    }
+}
+
+// Executa tarefas (ou cede o processador) até 'remaining' chegar a 0
+inline void structures::ThreadPool::help_until(
+const std::atomic<std::size_t>& remaining) {
+    while (remaining.load(std::memory_order_acquire) != 0) {
+        if (!run_one()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Laço de uma thread: executa tarefas e dorme quando não há nenhuma
+inline void structures::ThreadPool::worker_loop(std::size_t index) {
+    current() = Worker{this, index};
+    for (;;) {
+        if (run_one()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stopping_ && queued_.load() <= 0) {
+            return;
+        }
+        sleeping_.fetch_add(1);
+        work_cv_.wait(lock, [this] {
+            return stopping_ || queued_.load() > 0;
+        });
+        sleeping_.fetch_sub(1);
+    }
+}
+
+#endif
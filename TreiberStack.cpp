@@ -0,0 +1,353 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_TREIBER_STACK_H
+#define STRUCTURES_TREIBER_STACK_H
+
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::size_t, std::uint32_t, std::uint64_t
+#include <memory_resource>  // std::pmr::memory_resource
+#include <new>  // placement new
+#include <stdexcept>  // C++ exceptions
+#include <utility>  // std::move, std::forward
+
+#include "./SpscQueue.cpp"  // CACHE_LINE
+
+namespace structures {
+
+template<typename T>
+//! Pilha sem travas para várias threads (algoritmo de Treiber). O topo é
+//! uma palavra de 64 bits com o índice do nó (32 bits) e uma etiqueta
+//! (32 bits) que muda a cada troca, então um compare-exchange não confunde
+//! um topo que saiu e voltou (problema ABA). Os nós vêm de um pool da
+//! própria pilha e os retirados vão para uma lista livre, também
+//! etiquetada, em vez de voltar para o alocador: uma thread atrasada que
+//! ainda lê um nó retirado lê memória válida, e tudo é liberado só no
+//! destrutor.
+class TreiberStack {
+ public:
+    //! construtor simples
+    TreiberStack();
+    //! construtor com origem da memoria
+    explicit TreiberStack(
+        const std::pmr::polymorphic_allocator<T>& allocator);
+    TreiberStack(const TreiberStack&) = delete;
+    TreiberStack& operator=(const TreiberStack&) = delete;
+    //! destrutor
+    ~TreiberStack();
+    //! empilha uma copia
+    void push(const T& data);
+    //! empilha movendo o dado
+    void push(T&& data);
+    //! constroi o elemento no topo
+    template<typename... Args>
+    void emplace(Args&&... args);
+    //! move o topo para 'data'; false se vazia
+    bool try_pop(T& data);
+    //! pilha vazia (aproximado)
+    bool empty() const;
+    //! origem da memoria
+    std::pmr::memory_resource* resource() const;
+
+ protected:
+    // Uma única tentativa sobre o topo, para quem herda poder fazer outra
+    // coisa (como EliminationStack) quando a troca falha por disputa
+    enum class Attempt {
+        done,
+        empty,
+        contended,
+    };
+
+    struct Node {
+        std::atomic<std::uint32_t> next;  // índice + 1 do nó de baixo
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* data() {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    template<typename... Args>
+    std::uint32_t make_node(Args&&... args);  // ainda fora da pilha
+    bool try_push_node(std::uint32_t index);
+    Attempt try_pop_once(T& data);
+    void free_node(std::uint32_t index);  // destrói o elemento
+    Node* node(std::uint32_t index);
+
+ private:
+    // Palavra etiquetada: índice + 1 nos 32 bits baixos (0 é vazio) e a
+    // etiqueta nos 32 altos
+    static std::uint32_t index_of(std::uint64_t word);
+    static std::uint64_t make_word(std::uint64_t old_word,
+                                   std::uint32_t index);
+
+    void push_node(std::atomic<std::uint64_t>& top, std::uint32_t index);
+    std::uint32_t pop_node(std::atomic<std::uint64_t>& top);
+    std::uint32_t allocate_node();
+    static std::size_t segment_of(std::uint32_t index);
+    static std::size_t segment_first(std::size_t segment);
+    static std::size_t segment_size(std::size_t segment);
+
+    alignas(CACHE_LINE) std::atomic<std::uint64_t> top_{0u};
+    alignas(CACHE_LINE) std::atomic<std::uint64_t> free_{0u};
+    alignas(CACHE_LINE) std::atomic<std::uint64_t> next_index_{0u};
+
+    // O segmento k tem SEGMENT_BASE * 2^k nós, então 27 segmentos cobrem
+    // todos os índices de 32 bits sem mover nenhum nó ao crescer
+    static const std::size_t SEGMENT_BASE = 64u;
+    static const std::size_t MAX_SEGMENTS = 27u;
+    static const std::uint32_t MAX_NODES = 0xFFFFFFFEu;
+
+    std::atomic<Node*> segments_[MAX_SEGMENTS];
+    std::pmr::memory_resource* resource_;
+};
+
+}  // namespace structures
+
+// Construtor simples
+template<typename T>
+structures::TreiberStack<T>::TreiberStack():
+    TreiberStack(std::pmr::get_default_resource())
+{}
+
+// Construtor com memória vinda de 'allocator'
+template<typename T>
+structures::TreiberStack<T>::TreiberStack(
+const std::pmr::polymorphic_allocator<T>& allocator) {
+    for (std::size_t k = 0; k < MAX_SEGMENTS; k++) {
+        segments_[k].store(nullptr, std::memory_order_relaxed);
+    }
+    resource_ = allocator.resource();
+}
+
+// Destrutor: destrói o que ficou na pilha e libera os segmentos
+template<typename T>
+structures::TreiberStack<T>::~TreiberStack() {
+    std::uint32_t index = index_of(top_.load(std::memory_order_relaxed));
+    while (index != 0) {
+        Node* current = node(index - 1);
+        current->data()->~T();
+        index = current->next.load(std::memory_order_relaxed);
+    }
+    for (std::size_t k = 0; k < MAX_SEGMENTS; k++) {
+        Node* segment = segments_[k].load(std::memory_order_relaxed);
+        if (segment != nullptr) {
+            resource_->deallocate(segment, segment_size(k) * sizeof(Node),
+                                  alignof(Node));
+        }
+    }
+}
+
+// Empilha uma cópia do dado
+template<typename T>
+void structures::TreiberStack<T>::push(const T& data) {
+    emplace(data);
+}
+
+// Empilha movendo o dado
+template<typename T>
+void structures::TreiberStack<T>::push(T&& data) {
+    emplace(std::move(data));
+}
+
+// Constrói o elemento em um nó livre e publica o nó no topo
+template<typename T>
+template<typename... Args>
+void structures::TreiberStack<T>::emplace(Args&&... args) {
+    push_node(top_, make_node(std::forward<Args>(args)...));
+}
+
+// Retira o topo; o nó volta para a lista livre
+template<typename T>
+bool structures::TreiberStack<T>::try_pop(T& data) {
+    std::uint32_t index = pop_node(top_);
+    if (index == 0) {
+        return false;
+    }
+    data = std::move(*node(index - 1)->data());
+    free_node(index);
+    return true;
+}
+
+// Verifica se a pilha está vazia
+template<typename T>
+bool structures::TreiberStack<T>::empty() const {
+    return index_of(top_.load(std::memory_order_acquire)) == 0;
+}
+
+// Consulta a origem da memória da pilha
+template<typename T>
+std::pmr::memory_resource* structures::TreiberStack<T>::resource() const {
+    return resource_;
+}
+
+// Constrói o elemento em um nó livre (ou novo) que ainda não está na
+// pilha; retorna o índice + 1 do nó
+template<typename T>
+template<typename... Args>
+std::uint32_t structures::TreiberStack<T>::make_node(Args&&... args) {
+    std::uint32_t index = pop_node(free_);
+    if (index == 0) {
+        index = allocate_node();
+    }
+    try {
+        new (node(index - 1)->data()) T(std::forward<Args>(args)...);
+    } catch (...) {
+        push_node(free_, index);
+        throw;
+    }
+    return index;
+}
+
+// Tenta uma vez colocar o nó 'index' (índice + 1) no topo; false se outra
+// thread mudou o topo no meio
+template<typename T>
+bool structures::TreiberStack<T>::try_push_node(std::uint32_t index) {
+    std::uint64_t old_word = top_.load(std::memory_order_relaxed);
+    node(index - 1)->next.store(index_of(old_word),
+                                std::memory_order_relaxed);
+    return top_.compare_exchange_strong(old_word, make_word(old_word, index),
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed);
+}
+
+// Tenta uma vez retirar o topo para 'data'
+template<typename T>
+typename structures::TreiberStack<T>::Attempt
+structures::TreiberStack<T>::try_pop_once(T& data) {
+    std::uint64_t old_word = top_.load(std::memory_order_acquire);
+    std::uint32_t index = index_of(old_word);
+    if (index == 0) {
+        return Attempt::empty;
+    }
+    std::uint32_t next =
+        node(index - 1)->next.load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(old_word, make_word(old_word, next),
+                                      std::memory_order_acquire,
+                                      std::memory_order_relaxed)) {
+        return Attempt::contended;
+    }
+    data = std::move(*node(index - 1)->data());
+    free_node(index);
+    return Attempt::done;
+}
+
+// Destrói o elemento do nó 'index' (índice + 1), que já saiu da pilha, e
+// devolve o nó para a lista livre
+template<typename T>
+void structures::TreiberStack<T>::free_node(std::uint32_t index) {
+    node(index - 1)->data()->~T();
+    push_node(free_, index);
+}
+
+// Índice + 1 guardado em uma palavra etiquetada (0 se vazia)
+template<typename T>
+std::uint32_t structures::TreiberStack<T>::index_of(std::uint64_t word) {
+    return static_cast<std::uint32_t>(word);
+}
+
+// Palavra que substitui 'old_word': aponta para 'index' com a etiqueta
+// seguinte
+template<typename T>
+std::uint64_t structures::TreiberStack<T>::make_word(std::uint64_t old_word,
+std::uint32_t index) {
+    std::uint64_t tag = (old_word >> 32) + 1;
+    return (tag << 32) | index;
+}
+
+// Coloca o nó 'index' (índice + 1) no topo de 'top'
+template<typename T>
+void structures::TreiberStack<T>::push_node(std::atomic<std::uint64_t>& top,
+std::uint32_t index) {
+    Node* current = node(index - 1);
+    std::uint64_t old_word = top.load(std::memory_order_relaxed);
+    do {
+        current->next.store(index_of(old_word), std::memory_order_relaxed);
+    } while (!top.compare_exchange_weak(old_word, make_word(old_word, index),
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed));
+}
+
+// Retira o nó do topo de 'top'; retorna o índice + 1 dele, ou 0 se vazia.
+// O 'next' lido pode ser de um nó que outra thread já reutilizou, mas aí
+// a etiqueta mudou e o compare-exchange falha.
+template<typename T>
+std::uint32_t structures::TreiberStack<T>::pop_node(
+std::atomic<std::uint64_t>& top) {
+    std::uint64_t old_word = top.load(std::memory_order_acquire);
+    for (;;) {
+        std::uint32_t index = index_of(old_word);
+        if (index == 0) {
+            return 0;
+        }
+        std::uint32_t next =
+            node(index - 1)->next.load(std::memory_order_relaxed);
+        if (top.compare_exchange_weak(old_word, make_word(old_word, next),
+                                      std::memory_order_acquire,
+                                      std::memory_order_acquire)) {
+            return index;
+        }
+    }
+}
+
+// Reserva um nó nunca usado, instalando o segmento dele se preciso;
+// retorna o índice + 1
+template<typename T>
+std::uint32_t structures::TreiberStack<T>::allocate_node() {
+    std::uint64_t index =
+        next_index_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= MAX_NODES) {
+        throw std::out_of_range("pilha cheia");
+    }
+    std::size_t k = segment_of(static_cast<std::uint32_t>(index));
+    if (segments_[k].load(std::memory_order_acquire) == nullptr) {
+        std::size_t count = segment_size(k);
+        Node* segment = static_cast<Node*>(
+            resource_->allocate(count * sizeof(Node), alignof(Node)));
+        for (std::size_t i = 0; i < count; i++) {
+            new (&segment[i].next) std::atomic<std::uint32_t>(0u);
+        }
+        Node* expected = nullptr;
+        if (!segments_[k].compare_exchange_strong(expected, segment,
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_acquire)) {
+            // outra thread instalou o segmento primeiro
+            resource_->deallocate(segment, count * sizeof(Node),
+                                  alignof(Node));
+        }
+    }
+    return static_cast<std::uint32_t>(index + 1);
+}
+
+// Nó de índice 'index'
+template<typename T>
+typename structures::TreiberStack<T>::Node*
+structures::TreiberStack<T>::node(std::uint32_t index) {
+    std::size_t k = segment_of(index);
+    return segments_[k].load(std::memory_order_acquire) +
+           (index - segment_first(k));
+}
+
+// Segmento que guarda o nó 'index'
+template<typename T>
+std::size_t structures::TreiberStack<T>::segment_of(std::uint32_t index) {
+    std::size_t blocks = index / SEGMENT_BASE + 1;
+    std::size_t k = 0;
+    while (blocks > 1) {
+        blocks >>= 1;
+        k++;
+    }
+    return k;
+}
+
+// Primeiro índice do segmento 'segment'
+template<typename T>
+std::size_t structures::TreiberStack<T>::segment_first(std::size_t segment) {
+    return SEGMENT_BASE * ((std::size_t{1} << segment) - 1);
+}
+
+// Número de nós do segmento 'segment'
+template<typename T>
+std::size_t structures::TreiberStack<T>::segment_size(std::size_t segment) {
+    return SEGMENT_BASE << segment;
+}
+
+#endif
@@ -0,0 +1,254 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+#ifndef STRUCTURES_WORK_STEALING_DEQUE_H
+#define STRUCTURES_WORK_STEALING_DEQUE_H
+
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::size_t, std::int64_t
+#include <memory_resource>  // std::pmr::memory_resource
+#include <new>  // placement new
+#include <type_traits>  // std::is_trivially_copyable
+
+#include "./SpscQueue.cpp"  // CACHE_LINE
+
+namespace structures {
+
+template<typename T>
+//! Deque sem travas para roubo de tarefas (Chase e Lev). Só a thread dona
+//! chama push e pop, que trabalham no fundo como uma pilha (LIFO); as
+//! outras chamam steal, que retira do topo como uma fila (FIFO). Quando
+//! enche, a dona troca o vetor por um com o dobro do tamanho; os vetores
+//! antigos ficam guardados até o destrutor porque um ladrão atrasado pode
+//! ainda estar lendo deles. Um ladrão lê o elemento antes de saber se
+//! ganhou a disputa, então T precisa ser trivialmente copiável (ponteiros
+//! para tarefas, índices).
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "steal lê o elemento antes de reservá-lo");
+    static_assert(std::atomic<T>::is_always_lock_free,
+                  "os vetores guardam std::atomic<T> sem trava");
+
+ public:
+    //! construtor padrao
+    WorkStealingDeque();
+    //! construtor com origem da memoria
+    explicit WorkStealingDeque(
+        const std::pmr::polymorphic_allocator<T>& allocator);
+    //! construtor com capacidade inicial (arredondada para potencia de dois)
+    explicit WorkStealingDeque(std::size_t capacity,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    //! destrutor padrao
+    ~WorkStealingDeque();
+    //! dona: coloca no fundo (cresce se preciso)
+    void push(const T& data);
+    //! dona: retira do fundo; false se vazia
+    bool pop(T& data);
+    //! qualquer thread: retira do topo; false se vazia ou se perdeu a
+    //! disputa pelo elemento
+    bool steal(T& data);
+    //! tamanho aproximado
+    std::size_t size() const;
+    //! deque vazia (aproximado)
+    bool empty() const;
+    //! capacidade do vetor atual
+    std::size_t capacity() const;
+    //! origem da memoria
+    std::pmr::memory_resource* resource() const;
+
+ private:
+    // Vetor circular; os elementos vêm logo depois do cabeçalho
+    struct alignas(std::size_t) alignas(std::atomic<T>) Array {
+        std::size_t mask;  // capacidade - 1
+        Array* prev;  // vetor substituído por este
+
+        std::atomic<T>* slots() {
+            return reinterpret_cast<std::atomic<T>*>(this + 1);
+        }
+
+        T get(std::int64_t index) {
+            return slots()[static_cast<std::size_t>(index) & mask].load(
+                std::memory_order_acquire);
+        }
+
+        void put(std::int64_t index, const T& data) {
+            slots()[static_cast<std::size_t>(index) & mask].store(
+                data, std::memory_order_release);
+        }
+    };
+
+    Array* allocate(std::size_t capacity, Array* prev);
+    void deallocate(Array* array);
+    Array* grow(Array* array, std::int64_t top, std::int64_t bottom);
+
+    alignas(CACHE_LINE) std::atomic<std::int64_t> top_{0};  // ladrões
+    alignas(CACHE_LINE) std::atomic<std::int64_t> bottom_{0};  // dona
+    std::atomic<Array*> array_;
+    std::pmr::memory_resource* resource_;
+
+    static const auto DEFAULT_SIZE = 64u;
+};
+
+}  // namespace structures
+
+// Construtor com capacidade padrão
+template<typename T>
+structures::WorkStealingDeque<T>::WorkStealingDeque():
+    WorkStealingDeque(DEFAULT_SIZE)
+{}
+
+// Construtor com capacidade padrão e memória vinda de 'allocator'
+template<typename T>
+structures::WorkStealingDeque<T>::WorkStealingDeque(
+const std::pmr::polymorphic_allocator<T>& allocator):
+    WorkStealingDeque(DEFAULT_SIZE, allocator.resource())
+{}
+
+// Construtor com capacidade inicial, arredondada para potência de dois
+template<typename T>
+structures::WorkStealingDeque<T>::WorkStealingDeque(std::size_t capacity,
+std::pmr::memory_resource* resource) {
+    std::size_t size = 2;
+    while (size < capacity) {
+        size *= 2;
+    }
+    resource_ = resource;
+    array_.store(allocate(size, nullptr), std::memory_order_relaxed);
+}
+
+// Destrutor: libera o vetor atual e os substituídos
+template<typename T>
+structures::WorkStealingDeque<T>::~WorkStealingDeque() {
+    Array* array = array_.load(std::memory_order_relaxed);
+    while (array != nullptr) {
+        Array* prev = array->prev;
+        deallocate(array);
+        array = prev;
+    }
+}
+
+// Coloca um elemento no fundo, dobrando o vetor se estiver cheio
+template<typename T>
+void structures::WorkStealingDeque<T>::push(const T& data) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    Array* array = array_.load(std::memory_order_relaxed);
+    if (bottom - top > static_cast<std::int64_t>(array->mask)) {
+        array = grow(array, top, bottom);
+    }
+    array->put(bottom, data);
+    bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+// Retira o elemento do fundo. Com um único elemento, disputa com os
+// ladrões pelo topo; como a escrita de bottom_ e a leitura de top_ são
+// seq_cst (e o contrário em steal), a dona e um ladrão nunca ficam os dois
+// com ele.
+template<typename T>
+bool structures::WorkStealingDeque<T>::pop(T& data) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* array = array_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_seq_cst);
+    if (top > bottom) {
+        bottom_.store(bottom + 1, std::memory_order_relaxed);  // vazia
+        return false;
+    }
+    T value = array->get(bottom);
+    if (top == bottom) {
+        // último elemento: quem avançar o topo primeiro fica com ele
+        bool won = top_.compare_exchange_strong(top, top + 1,
+                                                std::memory_order_seq_cst,
+                                                std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        if (!won) {
+            return false;
+        }
+    }
+    data = value;
+    return true;
+}
+
+// Retira o elemento do topo
+template<typename T>
+bool structures::WorkStealingDeque<T>::steal(T& data) {
+    std::int64_t top = top_.load(std::memory_order_seq_cst);
+    std::int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+    if (top >= bottom) {
+        return false;
+    }
+    Array* array = array_.load(std::memory_order_acquire);
+    T value = array->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1,
+                                      std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+        return false;  // outro ladrão (ou a dona) levou
+    }
+    data = value;
+    return true;
+}
+
+// Consulta o tamanho da deque
+template<typename T>
+std::size_t structures::WorkStealingDeque<T>::size() const {
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+    return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+}
+
+// Verifica se a deque está vazia
+template<typename T>
+bool structures::WorkStealingDeque<T>::empty() const {
+    return size() == 0;
+}
+
+// Consulta a capacidade do vetor atual
+template<typename T>
+std::size_t structures::WorkStealingDeque<T>::capacity() const {
+    return array_.load(std::memory_order_acquire)->mask + 1;
+}
+
+// Consulta a origem da memória da deque
+template<typename T>
+std::pmr::memory_resource* structures::WorkStealingDeque<T>::resource() const {
+    return resource_;
+}
+
+// Aloca um vetor de 'capacity' posições em 'resource_'
+template<typename T>
+typename structures::WorkStealingDeque<T>::Array*
+structures::WorkStealingDeque<T>::allocate(std::size_t capacity,
+Array* prev) {
+    void* memory = resource_->allocate(
+        sizeof(Array) + capacity * sizeof(std::atomic<T>), alignof(Array));
+    Array* array = new (memory) Array{capacity - 1, prev};
+    for (std::size_t i = 0; i < capacity; i++) {
+        new (array->slots() + i) std::atomic<T>();
+    }
+    return array;
+}
+
+// Devolve um vetor para 'resource_'
+template<typename T>
+void structures::WorkStealingDeque<T>::deallocate(Array* array) {
+    std::size_t capacity = array->mask + 1;
+    resource_->deallocate(array,
+                          sizeof(Array) + capacity * sizeof(std::atomic<T>),
+                          alignof(Array));
+}
+
+// Dona: copia [top, bottom) para um vetor com o dobro do tamanho e o
+// publica; o antigo fica encadeado em 'prev' até o destrutor
+template<typename T>
+typename structures::WorkStealingDeque<T>::Array*
+structures::WorkStealingDeque<T>::grow(Array* array, std::int64_t top,
+std::int64_t bottom) {
+    Array* bigger = allocate((array->mask + 1) * 2, array);
+    for (std::int64_t i = top; i < bottom; i++) {
+        bigger->put(i, array->get(i));
+    }
+    array_.store(bigger, std::memory_order_release);
+    return bigger;
+}
+
+#endif
@@ -0,0 +1,65 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Inserções no início e remoções no meio de uma ArrayList<int> com 1M
+// elementos, contra o laço que desloca um elemento por vez.
+// g++ -std=c++17 -O2 -I.. array_list_shift_bench.cpp && ./a.out
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+
+#include "../ArrayList.cpp"
+
+namespace {
+
+constexpr std::size_t elements = 1000000;
+constexpr int operations = 1000;
+
+// Operações por segundo de 'operation', repetida 'operations' vezes
+template<typename Operation>
+double rate(Operation operation) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < operations; i++) {
+        operation();
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return operations / elapsed.count();
+}
+
+}  // namespace
+
+int main() {
+    structures::ArrayList<int> list(elements + operations);
+    for (std::size_t i = 0; i < elements; i++) {
+        list.push_back(static_cast<int>(i));
+    }
+    double front = rate([&list] { list.push_front(-1); });
+    double middle = rate([&list] { list.pop(list.size() / 2); });
+
+    // o mesmo trabalho deslocando um elemento por vez
+    std::unique_ptr<int[]> raw(new int[elements + operations]);
+    std::size_t size = elements;
+    for (std::size_t i = 0; i < size; i++) {
+        raw[i] = static_cast<int>(i);
+    }
+    volatile int* data = raw.get();  // impede que o laço vire memmove
+    double loop_front = rate([&] {
+        for (std::size_t i = size; i > 0; i--) {
+            data[i] = data[i - 1];
+        }
+        data[0] = -1;
+        size++;
+    });
+    double loop_middle = rate([&] {
+        for (std::size_t i = size / 2; i + 1 < size; i++) {
+            data[i] = data[i + 1];
+        }
+        size--;
+    });
+
+    std::printf("inserir no início: %.0f op/s (laço: %.0f op/s)\n",
+                front, loop_front);
+    std::printf("retirar do meio:   %.0f op/s (laço: %.0f op/s)\n",
+                middle, loop_middle);
+    return list.size() == elements ? 0 : 1;
+}
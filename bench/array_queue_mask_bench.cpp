@@ -0,0 +1,96 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// enqueue/dequeue da ArrayQueue (cursores de 64 bits e máscara) contra a
+// implementação anterior, que avançava os índices com módulo.
+// g++ -std=c++17 -O2 -I.. array_queue_mask_bench.cpp && ./a.out
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <stdexcept>
+
+#include "../ArrayQueue.cpp"
+
+namespace {
+
+// Cópia do laço quente da ArrayQueue antes dos cursores com máscara
+template<typename T>
+class ModuloQueue {
+ public:
+    explicit ModuloQueue(std::size_t max):
+        contents(new T[max]),
+        size_(0),
+        max_size_(max),
+        begin_(0),
+        end_(-1)
+    {}
+    ModuloQueue(const ModuloQueue&) = delete;
+    ModuloQueue& operator=(const ModuloQueue&) = delete;
+    ~ModuloQueue() {
+        delete[] contents;
+    }
+    void enqueue(const T& data) {
+        if (size_ == max_size_) {
+            throw std::out_of_range("fila cheia");
+        }
+        end_ = (end_ + 1) % max_size_;
+        contents[end_] = data;
+        size_++;
+    }
+    T dequeue() {
+        if (size_ == 0) {
+            throw std::out_of_range("fila vazia");
+        }
+        T data = contents[begin_];
+        begin_ = (begin_ + 1) % max_size_;
+        size_--;
+        return data;
+    }
+
+ private:
+    T* contents;
+    std::size_t size_;
+    std::size_t max_size_;
+    int begin_;
+    int end_;
+};
+
+constexpr long operations = 10000000;
+
+volatile long sink;  // impede que o compilador descarte os resultados
+
+// Menor tempo por operação, em ns, de enqueue+dequeue com a fila pela
+// metade, em 15 rodadas
+template<typename Queue>
+double churn(std::size_t capacity) {
+    double best = 1e9;
+    for (int round = 0; round < 15; round++) {
+        Queue queue(capacity);
+        for (std::size_t i = 0; i < capacity / 2; i++) {
+            queue.enqueue(static_cast<long>(i));
+        }
+        auto start = std::chrono::steady_clock::now();
+        long sum = 0;
+        for (long i = 0; i < operations; i++) {
+            queue.enqueue(i);
+            sum += queue.dequeue();
+        }
+        std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        sink = sum;
+        best = std::min(best, elapsed.count() / (2 * operations));
+    }
+    return best;
+}
+
+}  // namespace
+
+int main() {
+    for (std::size_t capacity : {std::size_t(10), std::size_t(1000),
+                                 std::size_t(1024)}) {
+        std::printf("capacidade %4zu: máscara %.2f ns, módulo %.2f ns\n",
+                    capacity,
+                    churn<structures::ArrayQueue<long>>(capacity),
+                    churn<ModuloQueue<long>>(capacity));
+    }
+    return 0;
+}
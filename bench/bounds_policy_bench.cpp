@@ -0,0 +1,73 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Custo da verificação de limites: at() em posições aleatórias e
+// push_back/pop_back de uma ArrayList<int> com bounds::checked e
+// bounds::unchecked.
+// g++ -std=c++17 -O2 -DNDEBUG -I.. bounds_policy_bench.cpp && ./a.out
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../ArrayList.cpp"
+#include "../BoundsPolicy.cpp"
+
+namespace {
+
+constexpr std::size_t elements = 1 << 16;
+constexpr std::size_t calls = 1 << 20;
+
+volatile long sink;  // impede que o compilador descarte os resultados
+
+// Menor tempo por chamada, em ns, de 'operation' em 50 rodadas
+template<typename Operation>
+double best(Operation operation) {
+    double result = 1e9;
+    for (int round = 0; round < 50; round++) {
+        auto start = std::chrono::steady_clock::now();
+        sink = operation();
+        std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        result = std::min(result, elapsed.count() / calls);
+    }
+    return result;
+}
+
+template<typename Bounds>
+void run(const char* name, const std::vector<std::size_t>& indices) {
+    structures::ArrayList<int, Bounds> list(elements + 1);
+    for (std::size_t i = 0; i < elements; i++) {
+        list.push_back(static_cast<int>(i));
+    }
+    double at = best([&] {
+        long sum = 0;
+        for (std::size_t index : indices) {
+            sum += list.at(index);
+        }
+        return sum;
+    });
+    double churn = best([&] {
+        long sum = 0;
+        for (std::size_t i = 0; i < calls; i++) {
+            list.push_back(static_cast<int>(i));
+            sum += list.pop_back();
+        }
+        return sum;
+    });
+    std::printf("%-10s at: %.2f ns  push_back+pop_back: %.2f ns\n",
+                name, at, churn);
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 random(42);
+    std::vector<std::size_t> indices(calls);
+    for (std::size_t& index : indices) {
+        index = random() % elements;
+    }
+    run<structures::bounds::checked>("checked", indices);
+    run<structures::bounds::unchecked>("unchecked", indices);
+    return 0;
+}
@@ -0,0 +1,104 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Contenção com metade das threads produzindo e metade consumindo, de 2 a
+// 16 threads: MpmcQueue contra uma ArrayQueue protegida por mutex.
+// g++ -std=c++17 -O2 -pthread -I.. mpmc_queue_bench.cpp && ./a.out
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../ArrayQueue.cpp"
+#include "../MpmcQueue.cpp"
+
+namespace {
+
+constexpr long items = 4000000;  // total, dividido entre os produtores
+constexpr std::size_t capacity = 1024;
+
+// Roda 'pairs' produtores e 'pairs' consumidores e devolve Mops/s
+template<typename Produce, typename Consume>
+double run(int pairs, Produce produce, Consume consume) {
+    long each = items / pairs;
+    std::vector<long> sums(pairs);
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < pairs; t++) {
+        threads.emplace_back([&, t] {
+            for (long i = 0; i < each; i++) {
+                produce(t * each + i);
+            }
+        });
+        threads.emplace_back([&, t] {
+            long sum = 0;
+            for (long i = 0; i < each; i++) {
+                sum += consume();
+            }
+            sums[t] = sum;
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    long sum = 0, total = each * pairs;
+    for (long partial : sums) {
+        sum += partial;
+    }
+    if (sum != total * (total - 1) / 2) {
+        std::printf("soma errada\n");
+    }
+    return total / elapsed.count() / 1e6;
+}
+
+}  // namespace
+
+int main() {
+    std::printf("threads  MpmcQueue  ArrayQueue+mutex (Mops/s)\n");
+    for (int threads = 2; threads <= 16; threads *= 2) {
+        structures::MpmcQueue<long> mpmc(capacity);
+        double lock_free = run(threads / 2,
+            [&mpmc](long i) {
+                while (!mpmc.try_enqueue(i)) {
+                    std::this_thread::yield();
+                }
+            },
+            [&mpmc] {
+                long value;
+                while (!mpmc.try_dequeue(value)) {
+                    std::this_thread::yield();
+                }
+                return value;
+            });
+
+        structures::ArrayQueue<long> queue(capacity);
+        std::mutex mutex;
+        double locked = run(threads / 2,
+            [&](long i) {
+                for (;;) {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!queue.full()) {
+                            queue.enqueue(i);
+                            return;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+            },
+            [&] {
+                for (;;) {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!queue.empty()) {
+                            return queue.dequeue();
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+            });
+        std::printf("%7d  %9.1f  %16.1f\n", threads, lock_free, locked);
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Vazão (GB/s) dos kernels find/count/min/max/sum contra o laço escalar,
+// em vetores de 10^6 e 10^7 elementos de int32, int64, float e double.
+// g++ -std=c++17 -O2 -I.. simd_kernels_bench.cpp && ./a.out
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "../SimdKernels.cpp"
+
+namespace {
+
+namespace kernels = structures::kernels;
+
+volatile double sink;  // impede que o compilador descarte os resultados
+
+// Melhor vazão, em GB/s, de 'operation' sobre 'bytes' bytes
+template<typename Operation>
+double throughput(std::size_t bytes, Operation operation) {
+    double best = 0;
+    for (int round = 0; round < 10; round++) {
+        auto start = std::chrono::steady_clock::now();
+        sink = static_cast<double>(operation());
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        best = std::max(best, bytes / elapsed.count() / 1e9);
+    }
+    return best;
+}
+
+template<typename T>
+void run(const char* name, std::size_t n) {
+    std::vector<T> values(n);
+    for (std::size_t i = 0; i < n; i++) {
+        values[i] = static_cast<T>(i % 1000);
+    }
+    const T* data = values.data();
+    const T missing = static_cast<T>(-1);  // find percorre tudo
+    std::size_t bytes = n * sizeof(T);
+    std::printf("%-7s n=%-9zu", name, n);
+    std::printf(" find %5.1f/%5.1f",
+        throughput(bytes, [&] { return kernels::find(data, n, missing); }),
+        throughput(bytes, [&] {
+            return kernels::detail::scalar_find(data, 0, n, missing);
+        }));
+    std::printf(" count %5.1f/%5.1f",
+        throughput(bytes, [&] { return kernels::count(data, n, data[7]); }),
+        throughput(bytes, [&] {
+            return kernels::detail::scalar_count(data, 0, n, data[7]);
+        }));
+    std::printf(" min %5.1f/%5.1f",
+        throughput(bytes, [&] { return kernels::min(data, n); }),
+        throughput(bytes, [&] {
+            return kernels::detail::scalar_min(data, 1, n, data[0]);
+        }));
+    std::printf(" max %5.1f/%5.1f",
+        throughput(bytes, [&] { return kernels::max(data, n); }),
+        throughput(bytes, [&] {
+            return kernels::detail::scalar_max(data, 1, n, data[0]);
+        }));
+    std::printf(" sum %5.1f/%5.1f\n",
+        throughput(bytes, [&] { return kernels::sum(data, n); }),
+        throughput(bytes, [&] {
+            return kernels::detail::scalar_sum(data, 0, n, T());
+        }));
+}
+
+}  // namespace
+
+int main() {
+    std::printf("GB/s, kernel/escalar\n");
+    for (std::size_t n : {std::size_t(1000000), std::size_t(10000000)}) {
+        run<std::int32_t>("int32", n);
+        run<std::int64_t>("int64", n);
+        run<float>("float", n);
+        run<double>("double", n);
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Alocações e tempo para montar 1M listas curtas: ArrayList contra
+// SmallArrayList, com lista de 4 a 12 elementos e buffer interno de 8.
+// g++ -std=c++17 -O2 -I.. small_array_list_bench.cpp && ./a.out
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <memory_resource>
+
+#include "../ArrayList.cpp"
+#include "../SmallArrayList.cpp"
+
+namespace {
+
+constexpr int lists = 1000000;
+
+// Conta as alocações e repassa ao recurso padrão
+class CountingResource : public std::pmr::memory_resource {
+ public:
+    std::size_t allocations = 0;
+
+ private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        allocations++;
+        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes,
+                       std::size_t alignment) override {
+        std::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other)
+    const noexcept override {
+        return this == &other;
+    }
+};
+
+volatile long sink;  // impede que o compilador descarte as listas
+
+// Monta 'lists' listas List(args..., recurso) de 'length' elementos e
+// imprime o custo
+template<typename List, typename... Args>
+void run(const char* name, int length, Args... args) {
+    CountingResource resource;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lists; i++) {
+        List list(args..., &resource);
+        for (int j = 0; j < length; j++) {
+            list.push_back(j);
+        }
+        sink = list.sum();
+    }
+    std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    std::printf("%-22s %2d elementos: %7zu alocações, %5.1f ns/lista\n",
+                name, length, resource.allocations, elapsed.count() / lists);
+}
+
+}  // namespace
+
+int main() {
+    for (int length : {4, 6, 8, 12}) {
+        run<structures::ArrayList<int>>("ArrayList(8)", length, 8u, 2.0);
+        run<structures::SmallArrayList<int, 8>>("SmallArrayList<int, 8>",
+                                                length, 2.0);
+    }
+    return 0;
+}
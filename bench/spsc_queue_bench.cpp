@@ -0,0 +1,111 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Milhões de operações por segundo entre uma thread produtora e uma
+// consumidora: SpscQueue contra uma ArrayQueue protegida por mutex. Em
+// Linux as threads são fixadas nas CPUs 0 e 1 quando existem.
+// g++ -std=c++17 -O2 -pthread -I.. spsc_queue_bench.cpp && ./a.out
+#include <pthread.h>
+#include <sched.h>
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "../ArrayQueue.cpp"
+#include "../SpscQueue.cpp"
+
+namespace {
+
+constexpr long items = 10000000;
+constexpr std::size_t capacity = 1024;
+
+// Fixa a thread atual na CPU 'cpu', se ela existir
+void pin(unsigned cpu) {
+#ifdef __linux__
+    if (cpu < std::thread::hardware_concurrency()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#else
+    (void)cpu;
+#endif
+}
+
+// Roda 'produce' e 'consume' em duas threads e devolve Mops/s
+template<typename Produce, typename Consume>
+double run(Produce produce, Consume consume) {
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        pin(0);
+        for (long i = 0; i < items; i++) {
+            produce(i);
+        }
+    });
+    long sum = 0;
+    std::thread consumer([&] {
+        pin(1);
+        for (long i = 0; i < items; i++) {
+            sum += consume();
+        }
+    });
+    producer.join();
+    consumer.join();
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (sum != items * (items - 1) / 2) {
+        std::printf("soma errada\n");
+    }
+    return items / elapsed.count() / 1e6;
+}
+
+}  // namespace
+
+int main() {
+    structures::SpscQueue<long> spsc(capacity);
+    double lock_free = run(
+        [&spsc](long i) {
+            while (!spsc.try_enqueue(i)) {
+                std::this_thread::yield();
+            }
+        },
+        [&spsc] {
+            long value;
+            while (!spsc.try_dequeue(value)) {
+                std::this_thread::yield();
+            }
+            return value;
+        });
+
+    structures::ArrayQueue<long> queue(capacity);
+    std::mutex mutex;
+    double locked = run(
+        [&](long i) {
+            for (;;) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!queue.full()) {
+                        queue.enqueue(i);
+                        return;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        },
+        [&] {
+            for (;;) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!queue.empty()) {
+                        return queue.dequeue();
+                    }
+                }
+                std::this_thread::yield();
+            }
+        });
+
+    std::printf("SpscQueue:          %6.1f Mops/s\n", lock_free);
+    std::printf("ArrayQueue + mutex: %6.1f Mops/s\n", locked);
+    return 0;
+}
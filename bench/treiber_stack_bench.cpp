@@ -0,0 +1,78 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Pares push/pop por segundo de 2 a 32 threads: TreiberStack contra uma
+// ArrayStack protegida por mutex.
+// g++ -std=c++17 -O2 -pthread -I.. treiber_stack_bench.cpp && ./a.out
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../ArrayStack.cpp"
+#include "../TreiberStack.cpp"
+
+namespace {
+
+constexpr long pairs = 2000000;  // total, dividido entre as threads
+
+// Cada thread alterna push e pop; devolve milhões de pares por segundo
+template<typename Push, typename Pop>
+double run(int threads, Push push, Pop pop) {
+    long each = pairs / threads;
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            for (long i = 0; i < each; i++) {
+                push(t * each + i);
+                pop();
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return each * threads / elapsed.count() / 1e6;
+}
+
+}  // namespace
+
+int main() {
+    std::printf("threads  TreiberStack  ArrayStack+mutex (M pares/s)\n");
+    for (int threads = 2; threads <= 32; threads *= 2) {
+        structures::TreiberStack<long> treiber;
+        double lock_free = run(threads,
+            [&treiber](long i) { treiber.push(i); },
+            [&treiber] {
+                long value;
+                // outra thread pode ter levado o valor desta
+                while (!treiber.try_pop(value)) {
+                    std::this_thread::yield();
+                }
+            });
+
+        structures::ArrayStack<long> stack(pairs);
+        std::mutex mutex;
+        double locked = run(threads,
+            [&](long i) {
+                std::lock_guard<std::mutex> lock(mutex);
+                stack.push(i);
+            },
+            [&] {
+                for (;;) {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!stack.empty()) {
+                            stack.pop();
+                            return;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+            });
+        std::printf("%7d  %12.1f  %16.1f\n", threads, lock_free, locked);
+    }
+    return 0;
+}
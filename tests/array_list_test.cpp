@@ -0,0 +1,108 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Crescer, inserir e retirar no meio de uma ArrayList não podem perder
+// elementos quando mover ou copiar um T lança: a lista fica como estava.
+// g++ -std=c++17 -I.. array_list_test.cpp && ./a.out
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+#include "../ArrayList.cpp"
+#include "../SmallArrayList.cpp"
+
+namespace {
+
+// Depois de 'budget' cópias ou movimentos, o próximo lança
+struct Fragile {
+    static int budget;
+    int value;
+
+    explicit Fragile(int v): value(v) {}
+    Fragile(const Fragile& other): value(other.value) {
+        spend();
+    }
+    Fragile(Fragile&& other): value(other.value) {
+        spend();
+        other.value = -1;
+    }
+    Fragile& operator=(const Fragile& other) = default;
+    Fragile& operator=(Fragile&& other) = default;
+
+    static void spend() {
+        if (budget >= 0 && budget-- == 0) {
+            throw std::runtime_error("falhou");
+        }
+    }
+};
+
+int Fragile::budget = -1;  // negativo: nunca lança
+
+template<typename List>
+void check(const List& list, std::size_t size) {
+    assert(list.size() == size);
+    for (std::size_t i = 0; i < size; i++) {
+        assert(list[i].value == static_cast<int>(i));
+    }
+}
+
+// Roda 'operation' com 0, 1, 2, ... cópias permitidas até ela dar certo;
+// toda tentativa que lança tem que deixar 0..size-1 intactos
+template<typename List, typename Operation>
+void fail_everywhere(List& list, std::size_t size, Operation operation) {
+    for (int budget = 0;; budget++) {
+        Fragile::budget = budget;
+        try {
+            operation(list);
+            Fragile::budget = -1;
+            return;
+        } catch (const std::runtime_error&) {
+            Fragile::budget = -1;
+            check(list, size);
+        }
+    }
+}
+
+template<typename List>
+void run(List& list) {
+    for (int i = 0; i < 8; i++) {
+        list.push_back(Fragile(i));
+    }
+    check(list, 8);
+    // cresce (o vetor está cheio ou quase)
+    fail_everywhere(list, 8, [](List& l) {
+        l.reserve(64);
+    });
+    check(list, 8);
+    // insere no meio e desfaz
+    fail_everywhere(list, 8, [](List& l) {
+        l.insert(Fragile(100), 3);
+    });
+    assert(list[3].value == 100);
+    list.pop(3);
+    check(list, 8);
+    // retira do meio e devolve
+    fail_everywhere(list, 8, [](List& l) {
+        Fragile value = l.pop(5);
+        assert(value.value == 5);
+        Fragile::budget = -1;
+        l.insert(value, 5);
+    });
+    check(list, 8);
+    // intervalo no meio
+    Fragile extra[] = {Fragile(200), Fragile(201)};
+    fail_everywhere(list, 8, [&extra](List& l) {
+        l.insert_range(2, extra, extra + 2);
+    });
+    assert(list.size() == 10 && list[2].value == 200);
+    list.erase_range(2, 4);
+    check(list, 8);
+}
+
+}  // namespace
+
+int main() {
+    structures::ArrayList<Fragile> list(4u, 2.0);
+    run(list);
+    structures::SmallArrayList<Fragile, 16> small;
+    run(small);
+    return 0;
+}
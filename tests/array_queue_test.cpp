@@ -0,0 +1,81 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// O encolhimento automático do modo growable dentro de dequeue não pode
+// perder elementos quando mover (ou copiar) um T lança. O modo overwrite
+// com capacidade 0 rejeita enqueue e descarta blocos inteiros.
+// g++ -std=c++17 -I.. array_queue_test.cpp && ./a.out
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+#include "../ArrayQueue.cpp"
+
+namespace {
+
+// Depois de 'moves' movimentos, mover lança; copiar lança se 'fail_copy'
+struct Fragile {
+    static int moves;
+    static bool fail_copy;
+    int value;
+
+    explicit Fragile(int v): value(v) {}
+    Fragile(const Fragile& other): value(other.value) {
+        if (fail_copy) {
+            throw std::runtime_error("cópia falhou");
+        }
+    }
+    Fragile(Fragile&& other): value(other.value) {
+        if (moves >= 0 && moves-- == 0) {
+            throw std::runtime_error("movimento falhou");
+        }
+        other.value = -1;
+    }
+};
+
+int Fragile::moves = -1;  // negativo: nunca lança
+bool Fragile::fail_copy = false;
+
+// Enche a fila com 0..63 e a esvazia deixando só o movimento do elemento
+// retirado dar certo; a ordem tem que continuar intacta
+void drain(bool fail_copy) {
+    structures::ArrayQueue<Fragile> queue(4u,
+                                          structures::QueueMode::growable);
+    for (int i = 0; i < 64; i++) {
+        queue.enqueue(Fragile(i));
+    }
+    std::size_t grown = queue.max_size();
+    for (int i = 0; i < 64; i++) {
+        Fragile::moves = 1;
+        Fragile::fail_copy = fail_copy;
+        int value = queue.dequeue().value;
+        Fragile::moves = -1;
+        Fragile::fail_copy = false;
+        assert(value == i);
+    }
+    assert(queue.empty());
+    // se copiar funciona, encolher copia em vez de mover
+    assert(fail_copy || queue.max_size() < grown);
+}
+
+// Capacidade 0 no modo overwrite: não há o mais antigo para descartar
+void overwrite_empty() {
+    structures::ArrayQueue<int> queue(0u, structures::QueueMode::overwrite);
+    bool thrown = false;
+    try {
+        queue.enqueue(1);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown && queue.empty() && queue.overwritten() == 0u);
+    int block[] = {1, 2, 3};
+    assert(queue.enqueue_bulk(block, 3) == 3u);
+    assert(queue.empty() && queue.overwritten() == 3u);
+}
+
+}  // namespace
+
+int main() {
+    drain(false);
+    drain(true);
+    overwrite_empty();
+    return 0;
+}
@@ -0,0 +1,42 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// BlockingQueue com um tipo só movível: push(T&&), emplace e try_push
+// movem para a fila, e um produtor esperando espaço entrega tudo em ordem.
+// g++ -std=c++17 -pthread -I.. blocking_queue_test.cpp && ./a.out
+#include <cassert>
+#include <memory>
+#include <thread>
+
+#include "../BlockingQueue.cpp"
+
+int main() {
+    using Item = std::unique_ptr<int>;
+    structures::BlockingQueue<Item> queue(2u);
+
+    Item first(new int(1));
+    assert(queue.push(std::move(first)));
+    assert(first == nullptr);
+    assert(queue.emplace(new int(2)));
+
+    Item extra(new int(3));
+    assert(!queue.try_push(std::move(extra)));  // cheia: não consome
+    assert(extra != nullptr && *extra == 3);
+
+    std::thread producer([&queue] {
+        for (int i = 3; i <= 100; i++) {
+            assert(queue.push(Item(new int(i))));
+        }
+        queue.close();
+    });
+    Item item;
+    int expected = 1;
+    while (queue.pop(item)) {
+        assert(item != nullptr && *item == expected);
+        expected++;
+    }
+    producer.join();
+    assert(expected == 101);
+
+    assert(!queue.push(std::move(extra)));  // fechada: não consome
+    assert(extra != nullptr);
+    return 0;
+}
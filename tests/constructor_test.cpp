@@ -0,0 +1,80 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Um 0 literal escolhe o construtor com tamanho (0 também é um ponteiro
+// nulo, e não pode ficar ambíguo com o construtor que recebe a memória);
+// um memory_resource* continua escolhendo o da memória.
+// g++ -std=c++17 -I.. constructor_test.cpp && ./a.out
+#include <cassert>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "../ArrayList.cpp"
+#include "../ArrayQueue.cpp"
+#include "../ArrayStack.cpp"
+#include "../BlockingQueue.cpp"
+#include "../DoublyCircularList.cpp"
+#include "../DoublyLinkedList.cpp"
+#include "../EliminationStack.cpp"
+#include "../GapBuffer.cpp"
+#include "../LindekList.cpp"
+#include "../MpmcQueue.cpp"
+#include "../SegmentedStack.cpp"
+#include "../SmallArrayList.cpp"
+#include "../SortedArrayList.cpp"
+#include "../SpscQueue.cpp"
+#include "../TreiberStack.cpp"
+#include "../WorkStealingDeque.cpp"
+
+int main() {
+    structures::ArrayList<int> list(0);
+    assert(list.max_size() == 0);
+    structures::ArrayStack<int> stack(0);
+    assert(stack.max_size() == 0);
+    structures::ArrayQueue<int> queue(0);
+    assert(queue.max_size() == 0);
+    structures::GapBuffer<int> gap(0u);
+    assert(gap.size() == 0);
+    structures::SortedArrayList<int> sorted(0);
+    assert(sorted.max_size() == 0);
+    structures::SmallArrayList<int, 4> small(0);
+    assert(small.is_inline());
+    structures::BlockingQueue<int> blocking(0);
+    assert(blocking.max_size() == 0);
+    structures::SpscQueue<int> spsc(0);
+    assert(spsc.max_size() == 0);
+    structures::MpmcQueue<int> mpmc(0);
+    assert(mpmc.max_size() == 2);
+    structures::WorkStealingDeque<int> deque(0);
+    assert(deque.capacity() == 2);
+    bool thrown = false;
+    try {
+        structures::SegmentedStack<int> segmented(0);
+    } catch (const std::out_of_range&) {
+        thrown = true;  // bloco vazio: foi o construtor com tamanho
+    }
+    assert(thrown);
+
+    std::pmr::monotonic_buffer_resource pool;
+    structures::ArrayList<int> list_in_pool(&pool);
+    assert(list_in_pool.resource() == &pool);
+    structures::ArrayStack<int> stack_in_pool(&pool);
+    assert(stack_in_pool.resource() == &pool);
+    structures::ArrayQueue<int> queue_in_pool(&pool);
+    assert(queue_in_pool.resource() == &pool);
+    structures::GapBuffer<int> gap_in_pool(&pool);
+    assert(gap_in_pool.resource() == &pool);
+    structures::BlockingQueue<int> blocking_in_pool(&pool);
+    assert(blocking_in_pool.resource() == &pool);
+    structures::SegmentedStack<int> segmented_in_pool(&pool);
+    assert(segmented_in_pool.resource() == &pool);
+    structures::LinkedList<int> linked_in_pool(&pool);
+    assert(linked_in_pool.resource() == &pool);
+    structures::DoublyLinkedList<int> doubly_in_pool(&pool);
+    assert(doubly_in_pool.resource() == &pool);
+    structures::DoublyCircularList<int> circular_in_pool(&pool);
+    assert(circular_in_pool.resource() == &pool);
+    structures::TreiberStack<int> treiber_in_pool(&pool);
+    assert(treiber_in_pool.resource() == &pool);
+    structures::EliminationStack<int> elimination_in_pool(&pool);
+    assert(elimination_in_pool.resource() == &pool);
+    return 0;
+}
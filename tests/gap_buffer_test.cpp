@@ -0,0 +1,87 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Mover o buraco e realocar um GapBuffer não podem perder elementos quando
+// mover ou copiar um T lança: a ordem continua a mesma.
+// g++ -std=c++17 -I.. gap_buffer_test.cpp && ./a.out
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+#include "../GapBuffer.cpp"
+
+namespace {
+
+// Depois de 'budget' cópias ou movimentos, o próximo lança
+struct Fragile {
+    static int budget;
+    int value;
+
+    explicit Fragile(int v): value(v) {}
+    Fragile(const Fragile& other): value(other.value) {
+        spend();
+    }
+    Fragile(Fragile&& other): value(other.value) {
+        spend();
+        other.value = -1;
+    }
+
+    static void spend() {
+        if (budget >= 0 && budget-- == 0) {
+            throw std::runtime_error("falhou");
+        }
+    }
+};
+
+int Fragile::budget = -1;  // negativo: nunca lança
+
+void check(const structures::GapBuffer<Fragile>& buffer, std::size_t size) {
+    assert(buffer.size() == size);
+    for (std::size_t i = 0; i < size; i++) {
+        assert(buffer[i].value == static_cast<int>(i));
+    }
+}
+
+// Roda 'operation' com 0, 1, 2, ... cópias permitidas até ela dar certo;
+// toda tentativa que lança tem que deixar 0..size-1 intactos
+template<typename Operation>
+void fail_everywhere(structures::GapBuffer<Fragile>& buffer,
+                     std::size_t size, Operation operation) {
+    for (int budget = 0;; budget++) {
+        Fragile::budget = budget;
+        try {
+            operation(buffer);
+            Fragile::budget = -1;
+            return;
+        } catch (const std::runtime_error&) {
+            Fragile::budget = -1;
+            check(buffer, size);
+        }
+    }
+}
+
+}  // namespace
+
+int main() {
+    structures::GapBuffer<Fragile> buffer(4u);
+    for (int i = 0; i < 4; i++) {
+        buffer.push_back(Fragile(i));
+    }
+    // cheio: o próximo insert realoca e depois leva o buraco ao início
+    fail_everywhere(buffer, 4, [](structures::GapBuffer<Fragile>& b) {
+        b.insert(Fragile(-5), 0);
+    });
+    assert(buffer[0].value == -5);
+    buffer.pop(0);
+    check(buffer, 4);
+    for (int i = 4; i < 8; i++) {
+        buffer.push_back(Fragile(i));
+    }
+    // o buraco está no fim: retirar do início atravessa todos
+    fail_everywhere(buffer, 8, [](structures::GapBuffer<Fragile>& b) {
+        Fragile value = b.pop(1);
+        assert(value.value == 1);
+        Fragile::budget = -1;
+        b.insert(value, 1);
+    });
+    check(buffer, 8);
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Tamanho do arquivo de uma MappedArrayList ao crescer e ao encolher,
+// conteúdo preservado ao reabrir depois de shrink_to_fit, e capacidades
+// cujo tamanho de arquivo estouraria (pedidas ou num cabeçalho corrompido).
+// g++ -std=c++17 -I.. mapped_array_list_test.cpp && ./a.out
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include "../MappedArrayList.cpp"
+
+namespace {
+
+std::size_t length(const std::string& path) {
+    struct stat info;
+    assert(::stat(path.c_str(), &info) == 0);
+    return static_cast<std::size_t>(info.st_size);
+}
+
+}  // namespace
+
+int main() {
+    std::string path = "mapped_array_list_test.bin";
+    ::unlink(path.c_str());
+    std::size_t small, large;
+    {
+        structures::MappedArrayList<long> list(path, 4u);
+        for (long i = 0; i < 10; i++) {
+            list.push_back(i);
+        }
+        small = length(path);
+        list.reserve(4096u);
+        large = length(path);
+        assert(large > small);
+        list.shrink_to_fit();
+        assert(list.max_size() == 10u);
+        assert(length(path) < small);
+        for (long i = 0; i < 10; i++) {
+            assert(list[i] == i);
+        }
+    }
+    {
+        structures::MappedArrayList<long> list(path);
+        assert(list.size() == 10u && list.max_size() == 10u);
+        for (long i = 0; i < 10; i++) {
+            assert(list[i] == i);
+        }
+        list.push_back(10);
+        assert(list.size() == 11u && list[10] == 10);
+        std::size_t capacity = list.max_size();
+        bool thrown = false;
+        try {
+            list.reserve(SIZE_MAX / 4);
+        } catch (const std::bad_array_new_length&) {
+            thrown = true;
+        }
+        assert(thrown && list.max_size() == capacity && list[10] == 10);
+    }
+    {
+        // max_size no cabeçalho (byte 24) com 2^62 elementos
+        int fd = ::open(path.c_str(), O_WRONLY);
+        std::uint64_t corrupt = std::uint64_t(1) << 62;
+        assert(::pwrite(fd, &corrupt, sizeof(corrupt), 24) ==
+               static_cast<ssize_t>(sizeof(corrupt)));
+        ::close(fd);
+        bool thrown = false;
+        try {
+            structures::MappedArrayList<long> list(path);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    ::unlink(path.c_str());
+    {
+        bool thrown = false;
+        try {
+            structures::MappedArrayList<long> list(path, SIZE_MAX / 4);
+        } catch (const std::bad_array_new_length&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    ::unlink(path.c_str());
+    return 0;
+}
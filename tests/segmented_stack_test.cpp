@@ -0,0 +1,84 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Um construtor de movimento que lança ao abrir um bloco novo não pode
+// perder o bloco: ele vira a reserva e a pilha continua usável.
+// g++ -std=c++17 -I.. segmented_stack_test.cpp && ./a.out
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "../SegmentedStack.cpp"
+
+namespace {
+
+// Conta os blocos vivos
+class CountingResource : public std::pmr::memory_resource {
+ public:
+    std::size_t live = 0;
+
+ private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+        live++;
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes,
+                       std::size_t align) override {
+        live--;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Lança ao ser movido enquanto 'fail' estiver ligado
+struct Fragile {
+    static bool fail;
+    int value;
+
+    explicit Fragile(int v): value(v) {}
+    Fragile(const Fragile& other) = default;
+    Fragile(Fragile&& other): value(other.value) {
+        if (fail) {
+            throw std::runtime_error("movimento falhou");
+        }
+    }
+};
+
+bool Fragile::fail = false;
+
+}  // namespace
+
+int main() {
+    CountingResource resource;
+    {
+        structures::SegmentedStack<Fragile> stack(2u, &resource);
+        stack.emplace(1);
+        stack.emplace(2);
+        assert(resource.live == 1u);
+
+        Fragile::fail = true;
+        bool thrown = false;
+        try {
+            stack.emplace(3);  // bloco cheio: abre outro e move para lá
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        assert(stack.size() == 2u && stack.top().value == 2);
+        assert(resource.live == 2u);  // o bloco novo ficou como reserva
+
+        Fragile::fail = false;
+        stack.emplace(3);  // usa a reserva
+        assert(resource.live == 2u);
+        assert(stack.size() == 3u && stack.top().value == 3);
+        assert(stack.pop().value == 3);
+        assert(stack.pop().value == 2);
+        assert(stack.pop().value == 1);
+        assert(stack.empty());
+    }
+    assert(resource.live == 0u);
+    return 0;
+}
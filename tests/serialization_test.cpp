@@ -0,0 +1,95 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// Cabeçalhos corrompidos em load(): quantidade que estoura o tamanho em
+// bytes, quantidade enorme (mas válida) com o conteúdo curto, que tem que
+// dar erro de leitura e não std::bad_alloc, e conteúdo mais curto que a
+// quantidade. Sequências maiores que um bloco de leitura são carregadas
+// inteiras.
+// g++ -std=c++17 -I.. serialization_test.cpp && ./a.out
+#include <cassert>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+
+#include "../ArrayList.cpp"
+#include "../ArrayQueue.cpp"
+#include "../ArrayStack.cpp"
+
+namespace {
+
+// Cabeçalho válido de 'count' longs seguido de 'present' elementos
+std::stringstream stream(std::uint64_t count, std::size_t present) {
+    std::stringstream ss;
+    structures::serialization::write_header<long>(ss, count);
+    for (std::size_t i = 0; i < present; i++) {
+        long value = static_cast<long>(i);
+        ss.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    return ss;
+}
+
+template<typename Container>
+void rejects(std::uint64_t count, std::size_t present) {
+    Container container;
+    std::stringstream ss = stream(count, present);
+    bool thrown = false;
+    try {
+        container.load(ss);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(container.size() == 0);
+}
+
+// Carrega 'count' longs (vários blocos de leitura) e confere o tamanho
+template<typename Container>
+void loads(std::size_t count) {
+    Container container;
+    std::stringstream ss = stream(count, count);
+    container.load(ss);
+    assert(container.size() == count && container.max_size() >= count);
+}
+
+}  // namespace
+
+int main() {
+    const std::uint64_t huge = std::uint64_t{1} << 61;  // * 8 dá 0
+    rejects<structures::ArrayList<long>>(huge, 0);
+    rejects<structures::ArrayStack<long>>(huge, 0);
+    rejects<structures::ArrayQueue<long>>(huge, 0);
+
+    const std::uint64_t large = std::uint64_t{1} << 40;  // 8 TiB
+    rejects<structures::ArrayList<long>>(large, 100);
+    rejects<structures::ArrayStack<long>>(large, 100);
+    rejects<structures::ArrayQueue<long>>(large, 100);
+
+    rejects<structures::ArrayList<long>>(5, 2);
+    rejects<structures::ArrayStack<long>>(5, 2);
+    rejects<structures::ArrayQueue<long>>(5, 2);
+
+    structures::ArrayList<long> list;
+    std::stringstream ss = stream(3, 3);
+    list.load(ss);
+    assert(list.size() == 3 && list[2] == 2);
+
+    loads<structures::ArrayList<long>>(10000);
+    loads<structures::ArrayStack<long>>(10000);
+    loads<structures::ArrayQueue<long>>(10000);
+    structures::ArrayList<long> many;
+    ss = stream(10000, 10000);
+    many.load(ss);
+    for (long i = 0; i < 10000; i++) {
+        assert(many[i] == i);
+    }
+    structures::ArrayStack<long> stack;
+    ss = stream(10000, 10000);
+    stack.load(ss);
+    assert(stack.top() == 9999);
+    structures::ArrayQueue<long> queue;
+    ss = stream(10000, 10000);
+    queue.load(ss);
+    for (long i = 0; i < 10000; i++) {
+        assert(queue.dequeue() == i);
+    }
+    return 0;
+}
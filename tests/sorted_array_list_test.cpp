@@ -0,0 +1,71 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// SortedArrayList com comparador com estado (sem construtor padrão) nos
+// construtores que o recebem, e lista vazia: buscas e remove por valor não
+// lançam, operações por posição lançam std::out_of_range.
+// g++ -std=c++17 -I.. sorted_array_list_test.cpp && ./a.out
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "../SortedArrayList.cpp"
+
+namespace {
+
+// Ordena pelo resto da divisão por 'modulus'
+struct ByRemainder {
+    int modulus;
+
+    explicit ByRemainder(int m): modulus(m) {}
+    bool operator()(int a, int b) const {
+        return a % modulus < b % modulus;
+    }
+};
+
+template<typename List>
+void check_order(List& list) {
+    list.insert(17);
+    list.insert(9);
+    list.insert(12);
+    assert(list.size() == 3u);
+    assert(list[0] == 12 && list[1] == 17 && list[2] == 9);  // 2, 7, 9
+}
+
+}  // namespace
+
+int main() {
+    std::pmr::monotonic_buffer_resource pool;
+    structures::SortedArrayList<int, ByRemainder> by_compare(
+        ByRemainder(10), &pool);
+    check_order(by_compare);
+    assert(by_compare.contains(29) && !by_compare.contains(3));
+    structures::SortedArrayList<int, ByRemainder> sized(3u, ByRemainder(10));
+    check_order(sized);
+    assert(sized.full());
+
+    structures::SortedArrayList<int> empty;
+    assert(empty.find(1) == 0u && !empty.contains(1));
+    assert(empty.lower_bound(1) == 0u && empty.upper_bound(1) == 0u);
+    empty.remove(1);  // não lança
+    assert(empty.empty());
+    bool thrown = false;
+    try {
+        empty.pop_front();
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        empty.at(0);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    empty.insert(5);
+    empty.remove(6);  // ausente: não faz nada
+    empty.remove(5);
+    assert(empty.empty());
+    return 0;
+}
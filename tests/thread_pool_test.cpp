@@ -0,0 +1,104 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// ThreadPool: spawn e wait, parallel_for aninhado, exceções relançadas e
+// spawn falhando no meio de um parallel_for, que tem que esperar os blocos
+// já criados antes de relançar.
+// g++ -std=c++17 -pthread -I.. thread_pool_test.cpp && ./a.out
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#include "../ThreadPool.cpp"
+
+namespace {
+
+// Alocações que a thread atual ainda pode fazer; negativo: sem limite
+thread_local int allocation_budget = -1;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (allocation_budget >= 0 && allocation_budget-- == 0) {
+        throw std::bad_alloc();
+    }
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+int main() {
+    structures::ThreadPool pool(4u);
+
+    std::atomic<int> counter(0);
+    for (int i = 0; i < 100; i++) {
+        pool.spawn([&counter] { counter++; });
+    }
+    pool.wait();
+    assert(counter.load() == 100);
+
+    // aninhado, com tarefas criando tarefas
+    std::atomic<long> sum(0);
+    pool.parallel_for(0, 64, [&](std::size_t i) {
+        pool.parallel_for(0, 100, [&](std::size_t j) {
+            sum += static_cast<long>(i * 100 + j);
+        });
+    });
+    assert(sum.load() == 6400L * 6399 / 2);
+
+    // exceção de body
+    bool thrown = false;
+    try {
+        pool.parallel_for(0, 1000, 10, [](std::size_t i) {
+            if (i == 500) {
+                throw std::runtime_error("falhou");
+            }
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // exceção de spawn: tenta falhar em cada alocação até dar certo
+    for (int budget = 0;; budget++) {
+        std::atomic<int> calls(0);
+        allocation_budget = budget;
+        try {
+            pool.parallel_for(0, 1000, 10, [&calls](std::size_t) {
+                std::this_thread::sleep_for(std::chrono::microseconds(10));
+                calls++;
+            });
+            allocation_budget = -1;
+            assert(calls.load() == 1000);
+            break;
+        } catch (const std::bad_alloc&) {
+            allocation_budget = -1;
+        }
+        // nenhum bloco pode rodar depois do retorno
+        int seen = calls.load();
+        assert(seen % 10 == 0 && seen < 1000);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        assert(calls.load() == seen);
+    }
+
+    pool.spawn([] { throw std::logic_error("falhou"); });
+    thrown = false;
+    try {
+        pool.wait();
+    } catch (const std::logic_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    return 0;
+}
@@ -0,0 +1,56 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// TreiberStack com N produtores e N consumidores ao mesmo tempo: cada
+// valor empilhado sai exatamente uma vez (soma e contagem batem).
+// g++ -std=c++17 -pthread -I.. treiber_stack_test.cpp && ./a.out
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+#include "../TreiberStack.cpp"
+
+int main() {
+    const int threads = 4;
+    const long each = 100000;
+    const long total = threads * each;
+    structures::TreiberStack<long> stack;
+
+    std::atomic<long> popped(0);
+    std::atomic<long> sum(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&stack, t, each] {
+            for (long i = 0; i < each; i++) {
+                stack.push(t * each + i);
+            }
+        });
+        workers.emplace_back([&] {
+            long value, local = 0;
+            while (popped.load() < total) {
+                if (stack.try_pop(value)) {
+                    local += value;
+                    popped++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            sum += local;
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    assert(popped.load() == total);
+    assert(sum.load() == total * (total - 1) / 2);
+    long value;
+    assert(stack.empty() && !stack.try_pop(value));
+
+    // reusa os nós liberados
+    for (long i = 0; i < 10; i++) {
+        stack.push(i);
+    }
+    for (long i = 9; i >= 0; i--) {
+        assert(stack.try_pop(value) && value == i);
+    }
+    return 0;
+}
@@ -0,0 +1,64 @@
+// Copyright [2022] <Lucas Castro Truppel Machado>
+// WorkStealingDeque com a dona empilhando e retirando enquanto três
+// ladrões roubam: cada valor sai exatamente uma vez, inclusive depois que
+// o vetor cresce.
+// g++ -std=c++17 -pthread -I.. work_stealing_deque_test.cpp && ./a.out
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+#include "../WorkStealingDeque.cpp"
+
+int main() {
+    // sozinha: LIFO no fundo, FIFO no topo, e crescimento
+    structures::WorkStealingDeque<long> deque(2u);
+    for (long i = 0; i < 100; i++) {
+        deque.push(i);
+    }
+    assert(deque.size() == 100u && deque.capacity() >= 100u);
+    long value;
+    assert(deque.pop(value) && value == 99);
+    assert(deque.steal(value) && value == 0);
+    while (deque.pop(value)) {}
+    assert(deque.empty() && !deque.steal(value));
+
+    const long total = 200000;
+    std::atomic<bool> done(false);
+    std::atomic<long> sum(0), count(0);
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; t++) {
+        thieves.emplace_back([&] {
+            long value, local = 0, taken = 0;
+            while (!done.load() || !deque.empty()) {
+                if (deque.steal(value)) {
+                    local += value;
+                    taken++;
+                }
+            }
+            sum += local;
+            count += taken;
+        });
+    }
+    long local = 0, taken = 0;
+    for (long i = 0; i < total; i++) {
+        deque.push(i);
+        if (i % 3 == 0 && deque.pop(value)) {
+            local += value;
+            taken++;
+        }
+    }
+    while (deque.pop(value)) {
+        local += value;
+        taken++;
+    }
+    done = true;
+    for (std::thread& thief : thieves) {
+        thief.join();
+    }
+    sum += local;
+    count += taken;
+    assert(count.load() == total);
+    assert(sum.load() == total * (total - 1) / 2);
+    return 0;
+}